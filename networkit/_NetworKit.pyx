@@ -3842,6 +3842,7 @@ cdef extern from "cpp/community/PLP.h":
 		_PLP(_Graph _G, _Partition baseClustering, count updateThreshold) except +
 		count numberOfIterations() except +
 		vector[count] getTiming() except +
+		void setWorklist(bool worklist) except +
 
 
 cdef class PLP(CommunityDetector):
@@ -3858,7 +3859,7 @@ cdef class PLP(CommunityDetector):
  	has the label that at least half of its neighbors have.
 	"""
 
-	def __cinit__(self, Graph G not None, count updateThreshold=none, count maxIterations=none, Partition baseClustering=None,):
+	def __cinit__(self, Graph G not None, count updateThreshold=none, count maxIterations=none, Partition baseClustering=None, worklist=False):
 		"""
 		Constructor to the Parallel label propagation community detection algorithm.
 
@@ -3870,6 +3871,8 @@ cdef class PLP(CommunityDetector):
 			number of nodes that have to be changed in each iteration so that a new iteration starts.
 		baseClustering : Partition
 			PLP needs a base clustering to start from; if none is given the algorithm will run on a singleton clustering.
+		worklist : bool
+			only process the nodes whose neighborhood changed in the previous iteration instead of all nodes.
 		"""
 		self._G = G
 
@@ -3878,6 +3881,7 @@ cdef class PLP(CommunityDetector):
 			self._this = new _PLP(G._this, updateThreshold, maxIterations)
 		else:
 			self._this = new _PLP(G._this, baseClustering._this, updateThreshold)
+		(<_PLP*>(self._this)).setWorklist(worklist)
 
 
 	def numberOfIterations(self):
@@ -3927,7 +3931,7 @@ cdef class LPDegreeOrdered(CommunityDetector):
 cdef extern from "cpp/community/PLM.h":
 	cdef cppclass _PLM "NetworKit::PLM"(_CommunityDetectionAlgorithm):
 		_PLM(_Graph _G) except +
-		_PLM(_Graph _G, bool refine, double gamma, string par, count maxIter, bool turbo, bool recurse) except +
+		_PLM(_Graph _G, bool refine, double gamma, string par, count maxIter, bool turbo, bool recurse, bool hashAffinity, bool leiden) except +
 		map[string, vector[count]] getTiming() except +
 
 cdef extern from "cpp/community/PLM.h" namespace "NetworKit::PLM":
@@ -3958,11 +3962,17 @@ cdef class PLM(CommunityDetector):
 			faster but uses O(n) additional memory per thread
 		recurse: bool, optional
 			use recursive coarsening, see http://journals.aps.org/pre/abstract/10.1103/PhysRevE.89.049902 for some explanations (default: true)
+		hashAffinity: bool, optional
+			collect neighboring communities in per-thread hash tables, almost as fast as turbo but the additional memory
+			is bounded by the maximum degree (ignored if turbo is set)
+		leiden: bool, optional
+			Leiden-style refinement: coarsen by connected subcommunities of the move phase communities and start the
+			next level from the move phase communities (requires recurse)
 	"""
 
-	def __cinit__(self, Graph G not None, refine=False, gamma=1.0, par="balanced", maxIter=32, turbo=False, recurse=True):
+	def __cinit__(self, Graph G not None, refine=False, gamma=1.0, par="balanced", maxIter=32, turbo=False, recurse=True, hashAffinity=False, leiden=False):
 		self._G = G
-		self._this = new _PLM(G._this, refine, gamma, stdstring(par), maxIter, turbo, recurse)
+		self._this = new _PLM(G._this, refine, gamma, stdstring(par), maxIter, turbo, recurse, hashAffinity, leiden)
 
 	def getTiming(self):
 		"""  Get detailed time measurements.
@@ -3978,6 +3988,51 @@ cdef class PLM(CommunityDetector):
 	def prolong(Graph Gcoarse, Partition zetaCoarse, Graph Gfine, vector[node] nodeToMetaNode):
 		return Partition().setThis(PLM_prolong(Gcoarse._this, zetaCoarse._this, Gfine._this, nodeToMetaNode))
 
+cdef extern from "cpp/community/DynPLM.h":
+	cdef cppclass _DynPLM "NetworKit::DynPLM"(_CommunityDetectionAlgorithm):
+		_DynPLM(_Graph _G, double gamma, string par, count maxIter) except +
+		_DynPLM(_Graph _G, _Partition previous, double gamma, string par, count maxIter) except +
+		void update(vector[_GraphEvent] batch) except +
+
+cdef class DynPLM(CommunityDetector):
+	""" Dynamic community detection with the move phase of PLM. After the graph has changed, only the endpoints
+		of changed edges and new nodes are moved, starting from the previous partition, and the neighbors of moved
+		nodes are visited next.
+
+		Parameters
+		----------
+		G : Graph
+			A graph.
+		previous : Partition, optional
+			A partition of G to start from; if none is given, run() computes one with PLM.
+		gamma : double
+			Multi-resolution modularity parameter, see PLM.
+		par : string
+			parallelization strategy
+		maxIter : count
+			maximum number of iterations for move phase
+	"""
+
+	def __cinit__(self, Graph G not None, Partition previous=None, gamma=1.0, par="balanced", maxIter=32):
+		self._G = G
+		if previous is None:
+			self._this = new _DynPLM(G._this, gamma, stdstring(par), maxIter)
+		else:
+			self._this = new _DynPLM(G._this, previous._this, gamma, stdstring(par), maxIter)
+
+	def update(self, batch):
+		""" Updates the communities after the events in `batch` have been applied to the graph.
+
+		Parameters
+		----------
+		batch : list of GraphEvent.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for ev in batch:
+			_batch.push_back(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+		(<_DynPLM*>(self._this)).update(_batch)
+		return self
+
 cdef extern from "cpp/community/CutClustering.h":
 	cdef cppclass _CutClustering "NetworKit::CutClustering"(_CommunityDetectionAlgorithm):
 		_CutClustering(_Graph _G) except +
@@ -4953,7 +5008,7 @@ cdef class EffectiveDiameter:
 	@staticmethod
 	def effectiveDiameter(Graph G, double ratio=0.9, count k=64, count r=7):
 		""" Estimates the number of edges on average needed to reach 90% of all other nodes with a variaton of the ANF algorithm presented in the paper A Fast and Scalable Tool for Data Mining
-			in Massive Graphs by Palmer, Gibbons and Faloutsos
+			in Massive Graphs by Palmer, Gibbons and Faloutsos, using the HyperLogLog counters of HyperBall
 		Parameters
 		----------
 		G : Graph
@@ -4961,9 +5016,9 @@ cdef class EffectiveDiameter:
 		ratio : double
 			The percentage of nodes that shall be within stepwith
 		k : count
-			number of parallel approximations, bigger k -> longer runtime, more precise result
+			number of registers per HyperLogLog counter, bigger k -> longer runtime, more precise result
 		r : count
-			number of additional bits, important in tiny graphs
+			unused, kept for compatibility
 		Returns
 		-------
 		double
@@ -5004,9 +5059,9 @@ cdef class EffectiveDiameter:
 			maximum distance between considered nodes
 			set to 0 or negative to get the hop-plot for the entire graph so that each node can reach each other node
 		k : count
-			number of parallel approximations, bigger k -> longer runtime, more precise result
+			number of registers per HyperLogLog counter, bigger k -> longer runtime, more precise result
 		r : count
-			number of additional bits, important in tiny graphs
+			unused, kept for compatibility
 		Returns
 		-------
 		map
@@ -5015,6 +5070,63 @@ cdef class EffectiveDiameter:
 		return hopPlot(G._this, maxDistance, k, r)
 
 
+cdef extern from "cpp/distance/HyperBall.h":
+	cdef cppclass _HyperBall "NetworKit::HyperBall"(_Algorithm):
+		_HyperBall(_Graph G, count log2m, count maxDistance) except +
+		vector[double] getHarmonic() except +
+		vector[double] getCloseness(bool normalized) except +
+		vector[double] getFarness() except +
+		vector[double] getReachable() except +
+		vector[double] getNeighborhoodFunction() except +
+
+cdef class HyperBall(Algorithm):
+	""" Approximates the size of the ball of every radius around every node with HyperLogLog counters, according to
+	Boldi and Vigna: In-Core Computation of Geometric Centralities with HyperBall. From these, it computes approximate
+	harmonic centrality, closeness, the number of reachable nodes and the neighborhood function in a few linear passes.
+	Works on disconnected graphs, edge weights are ignored.
+
+	HyperBall(G, log2m=6, maxDistance=0)
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	log2m : count, optional
+		Logarithm of the number of registers per counter, between 4 and 16. The relative error is about 1.04 / sqrt(2^log2m).
+	maxDistance : count, optional
+		The largest radius to consider, 0 for no limit.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, log2m=6, maxDistance=0):
+		self._G = G
+		self._this = new _HyperBall(G._this, log2m, maxDistance)
+
+	def __dealloc__(self):
+		self._G = None
+
+	def getHarmonic(self):
+		""" Returns the approximate harmonic centrality, the sum of 1 / d(v, u) over all nodes u reachable from v. """
+		return (<_HyperBall*>(self._this)).getHarmonic()
+
+	def getCloseness(self, normalized=False):
+		""" Returns the approximate closeness with respect to the reachable nodes: 1 / farness, or
+		(reachable - 1) / farness if `normalized` is True. """
+		return (<_HyperBall*>(self._this)).getCloseness(normalized)
+
+	def getFarness(self):
+		""" Returns the approximate sum of the distances to all nodes reachable from each node. """
+		return (<_HyperBall*>(self._this)).getFarness()
+
+	def getReachable(self):
+		""" Returns the approximate number of nodes reachable from each node, including the node itself. """
+		return (<_HyperBall*>(self._this)).getReachable()
+
+	def getNeighborhoodFunction(self):
+		""" Returns the approximate neighborhood function: at index t, the number of node pairs with distance at most t. """
+		return (<_HyperBall*>(self._this)).getNeighborhoodFunction()
+
+
 cdef extern from "cpp/correlation/Assortativity.h":
 	cdef cppclass _Assortativity "NetworKit::Assortativity"(_Algorithm):
 		_Assortativity(_Graph, vector[double]) except +
@@ -5130,6 +5242,7 @@ cdef extern from "cpp/centrality/Betweenness.h":
 	cdef cppclass _Betweenness "NetworKit::Betweenness" (_Centrality):
 		_Betweenness(_Graph, bool, bool) except +
 		vector[double] edgeScores() except +
+		void setMemoryBounded(count) except +
 
 cdef class Betweenness(Centrality):
 	"""
@@ -5163,6 +5276,18 @@ cdef class Betweenness(Centrality):
 		"""
 		return (<_Betweenness*>(self._this)).edgeScores()
 
+	def setMemoryBounded(self, count concurrentSources):
+		""" Bound the memory of run() by processing at most `concurrentSources` sources at the same time,
+		each with a workspace that is reused for all of its sources. With one concurrent source on an
+		unweighted graph, all threads work on the same source.
+
+		Parameters
+		----------
+		concurrentSources : count
+			Number of sources processed at the same time, 0 restores the default thread-local mode.
+		"""
+		(<_Betweenness*>(self._this)).setMemoryBounded(concurrentSources)
+
 
 cdef extern from "cpp/centrality/Closeness.h":
 	cdef cppclass _Closeness "NetworKit::Closeness" (_Centrality):
@@ -5190,6 +5315,63 @@ cdef class Closeness(Centrality):
 		self._this = new _Closeness(G._this, normalized, checkConnectedness)
 
 
+cdef extern from "cpp/centrality/TopCloseness.h":
+	cdef cppclass _TopCloseness "NetworKit::TopCloseness"(_Algorithm):
+		_TopCloseness(_Graph G, count k, bool checkConnectedness) except +
+		vector[node] topkNodesList() except +
+		vector[double] topkScoresList() except +
+		count numberOfCompleteSearches() except +
+
+cdef class TopCloseness(Algorithm):
+	""" Computes the exact k nodes with the highest closeness centrality of an unweighted, (strongly) connected
+	graph. The BFS of a candidate is stopped as soon as a lower bound of its farness cannot beat the k-th best
+	farness found so far.
+
+	TopCloseness(G, k=1, checkConnectedness=True)
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	k : count, optional
+		Number of nodes with the highest closeness to compute.
+	checkConnectedness : bool, optional
+		turn this off if you know the graph is (strongly) connected
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, k=1, checkConnectedness=True):
+		self._G = G
+		self._this = new _TopCloseness(G._this, k, checkConnectedness)
+
+	def __dealloc__(self):
+		self._G = None
+
+	def topkNodesList(self):
+		""" Returns the k nodes with the highest closeness, in decreasing order of closeness.
+
+		Returns
+		-------
+		list
+			The top-k nodes.
+		"""
+		return (<_TopCloseness*>(self._this)).topkNodesList()
+
+	def topkScoresList(self):
+		""" Returns the normalized closeness (n-1) / farness of the nodes of topkNodesList().
+
+		Returns
+		-------
+		list
+			The top-k closeness scores.
+		"""
+		return (<_TopCloseness*>(self._this)).topkScoresList()
+
+	def numberOfCompleteSearches(self):
+		""" Returns the number of BFS runs that were not stopped early. """
+		return (<_TopCloseness*>(self._this)).numberOfCompleteSearches()
+
+
 cdef extern from "cpp/centrality/KPathCentrality.h":
 	cdef cppclass _KPathCentrality "NetworKit::KPathCentrality" (_Centrality):
 		_KPathCentrality(_Graph, double, count) except +
@@ -5278,6 +5460,47 @@ cdef class ApproxBetweenness(Centrality):
 
 
 
+cdef extern from "cpp/centrality/KadabraBetweenness.h":
+	cdef cppclass _KadabraBetweenness "NetworKit::KadabraBetweenness" (_Centrality):
+		_KadabraBetweenness(_Graph, double, double, count) except +
+		count numberOfSamples() except +
+		count maxNumberOfSamples() except +
+
+cdef class KadabraBetweenness(Centrality):
+	""" Adaptive approximation of betweenness centrality according to algorithm described in
+	Michele Borassi and Emanuele Natale: KADABRA is an ADaptive Algorithm for Betweenness via Random Approximation
+
+	KadabraBetweenness(G, epsilon=0.01, delta=0.1, diameterSamples=0)
+
+	The algorithm approximates the betweenness of all vertices so that the scores are
+	within an additive error epsilon with probability at least (1- delta). Unlike ApproxBetweenness,
+	it stops sampling as soon as the confidence intervals of all nodes are small enough.
+	The values are normalized. Only unweighted graphs are supported.
+
+	Parameters
+	----------
+	G : Graph
+		the graph
+	epsilon : double, optional
+		maximum additive error
+	delta : double, optional
+		probability that the values are within the error guarantee
+	diameterSamples : count, optional
+		if 0, estimate the vertex diameter pedantically, otherwise use a heuristic with this number of samples
+	"""
+
+	def __cinit__(self, Graph G, epsilon=0.01, delta=0.1, diameterSamples=0):
+		self._G = G
+		self._this = new _KadabraBetweenness(G._this, epsilon, delta, diameterSamples)
+
+	def numberOfSamples(self):
+		return (<_KadabraBetweenness*>(self._this)).numberOfSamples()
+
+	def maxNumberOfSamples(self):
+		return (<_KadabraBetweenness*>(self._this)).maxNumberOfSamples()
+
+
+
 cdef extern from "cpp/centrality/ApproxBetweenness2.h":
 	cdef cppclass _ApproxBetweenness2 "NetworKit::ApproxBetweenness2" (_Centrality):
 		_ApproxBetweenness2(_Graph, count, bool, bool) except +
@@ -5340,9 +5563,19 @@ cdef class ApproxCloseness(Centrality):
 		self._this = new _ApproxCloseness(G._this, nSamples, normalized)
 
 
+cdef extern from "cpp/centrality/PageRank.h":
+	enum _PageRankNorm "NetworKit::PageRank::Norm":
+		L1_NORM,
+		L2_NORM,
+		L_INF_NORM
+
 cdef extern from "cpp/centrality/PageRank.h":
 	cdef cppclass _PageRank "NetworKit::PageRank" (_Centrality):
 		_PageRank(_Graph, double damp, double tol) except +
+		void setNorm(_PageRankNorm norm) except +
+		void setMaxIterations(count maxIterations) except +
+		void setGaussSeidel(bool gaussSeidel) except +
+		count numberOfIterations() except +
 
 cdef class PageRank(Centrality):
 	"""	Compute PageRank as node centrality measure.
@@ -5359,10 +5592,38 @@ cdef class PageRank(Centrality):
 		Error tolerance for PageRank iteration.
 	"""
 
+	L1_NORM = 0
+	L2_NORM = 1
+	L_INF_NORM = 2
+
 	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9):
 		self._G = G
 		self._this = new _PageRank(G._this, damp, tol)
 
+	def setNorm(self, _PageRankNorm norm):
+		""" Sets the norm of the score difference between two iterations that is compared with the tolerance.
+
+		Parameters
+		----------
+		norm : PageRank.L1_NORM, PageRank.L2_NORM (default) or PageRank.L_INF_NORM
+		"""
+		(<_PageRank*>(self._this)).setNorm(norm)
+		return self
+
+	def setMaxIterations(self, count maxIterations):
+		""" Stops the iteration after maxIterations iterations even if the tolerance has not been reached. """
+		(<_PageRank*>(self._this)).setMaxIterations(maxIterations)
+		return self
+
+	def setGaussSeidel(self, bool gaussSeidel):
+		""" Updates the scores in place (Gauss-Seidel) instead of from the previous iteration, which usually needs fewer iterations. """
+		(<_PageRank*>(self._this)).setGaussSeidel(gaussSeidel)
+		return self
+
+	def numberOfIterations(self):
+		""" Returns the number of iterations of the last run. """
+		return (<_PageRank*>(self._this)).numberOfIterations()
+
 
 
 cdef extern from "cpp/centrality/EigenvectorCentrality.h":
@@ -0,0 +1,121 @@
+/*
+ * HashAccumulator.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef HASHACCUMULATOR_H_
+#define HASHACCUMULATOR_H_
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Aux {
+
+/**
+ * Accumulates values for a small set of integer keys, e.g. the edge weights to the neighboring communities of a
+ * node. Open addressing with linear probing on a power-of-two table that is kept between calls to reset(),
+ * so reusing one accumulator per thread avoids allocations and the memory stays proportional to the largest
+ * number of keys seen at once (instead of the key range, as for a dense array).
+ */
+template<class Val = double>
+class HashAccumulator {
+public:
+	static constexpr uint64_t none = std::numeric_limits<uint64_t>::max();
+
+	HashAccumulator() : mask(0) {}
+
+	/**
+	 * Removes all entries and makes room for up to @a maxKeys keys without rehashing.
+	 */
+	void reset(uint64_t maxKeys) {
+		uint64_t capacity = 16;
+		while (capacity < 2 * maxKeys) {
+			capacity *= 2;
+		}
+		if (capacity > keys.size()) {
+			keys.assign(capacity, none);
+			values.resize(capacity);
+			mask = capacity - 1;
+		} else {
+			for (uint64_t slot : used) {
+				keys[slot] = none;
+			}
+		}
+		used.clear();
+	}
+
+	/**
+	 * Adds @a value to the entry of @a key, which is created with value 0 if it does not exist.
+	 * At most the number of keys passed to reset() may be stored.
+	 */
+	void add(uint64_t key, Val value) {
+		values[findOrInsert(key)] += value;
+	}
+
+	/**
+	 * @return The accumulated value of @a key, 0 if @a key has no entry.
+	 */
+	Val get(uint64_t key) const {
+		assert(key != none);
+		for (uint64_t slot = hash(key); ; slot = (slot + 1) & mask) {
+			if (keys[slot] == key) {
+				return values[slot];
+			} else if (keys[slot] == none) {
+				return Val(0);
+			}
+		}
+	}
+
+	/**
+	 * @return The number of keys with an entry.
+	 */
+	uint64_t size() const {
+		return used.size();
+	}
+
+	/**
+	 * Calls @a handle(key, value) for all entries in the order in which they were created.
+	 */
+	template<typename L>
+	void forEntries(L handle) const {
+		for (uint64_t slot : used) {
+			handle(keys[slot], values[slot]);
+		}
+	}
+
+private:
+	std::vector<uint64_t> keys;
+	std::vector<Val> values;
+	std::vector<uint64_t> used; // occupied slots in insertion order
+	uint64_t mask;
+
+	uint64_t hash(uint64_t key) const {
+		// Fibonacci hashing, the high bits are the well mixed ones
+		return ((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+	}
+
+	uint64_t findOrInsert(uint64_t key) {
+		assert(key != none);
+		for (uint64_t slot = hash(key); ; slot = (slot + 1) & mask) {
+			if (keys[slot] == key) {
+				return slot;
+			} else if (keys[slot] == none) {
+				assert(2 * used.size() < keys.size());
+				keys[slot] = key;
+				values[slot] = Val(0);
+				used.push_back(slot);
+				return slot;
+			}
+		}
+	}
+};
+
+template<class Val>
+constexpr uint64_t HashAccumulator<Val>::none;
+
+} /* namespace Aux */
+
+#endif /* HASHACCUMULATOR_H_ */
@@ -13,6 +13,8 @@
 #include <vector>
 #include <limits>
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
 
 #include "../auxiliary/Log.h"
 
@@ -21,17 +23,25 @@ namespace Aux {
 /**
  * Priority queue with extract-min and decrease-key.
  * The type Val takes on integer values between 0 and n-1.
- * O(n log n) for construction, O(log n) for typical operations.
+ * Implemented as an addressable d-ary heap on contiguous arrays: the heap stores key-value pairs and a
+ * position index maps every value to its slot in the heap. Elements are ordered by key, ties by value.
+ * O(n) for construction, O(log n) for typical operations.
  */
 template<class Key, class Val>
 class PrioQueue {
 	typedef std::pair<Key, Val> ElemType;
 
 private:
-	std::set<ElemType> pqset;
-	std::vector<Key> mapValToKey;
+	static constexpr uint64_t arity = 4;
+	static constexpr uint64_t notInHeap = std::numeric_limits<uint64_t>::max();
 
-	const Key undefined = std::numeric_limits<Key>::max(); // TODO: make static
+	std::vector<ElemType> heap;
+	std::vector<uint64_t> position; // slot of each value in heap, notInHeap if absent
+
+	void siftUp(uint64_t i);
+	void siftDown(uint64_t i);
+	void buildHeap();
+	void ensureCapacity(Val value);
 
 public:
 	/**
@@ -100,47 +110,124 @@ public:
 	 * DEBUGGING
 	 */
 	virtual void print() {
-		DEBUG("num entries: ", mapValToKey.size());
-		for (uint64_t i = 0; i < mapValToKey.size(); ++i) {
-			DEBUG("key: ", mapValToKey[i], ", val: ", i, "\n");
+		DEBUG("num entries: ", heap.size());
+		for (uint64_t i = 0; i < heap.size(); ++i) {
+			DEBUG("key: ", heap[i].first, ", val: ", heap[i].second, "\n");
 		}
 	}
 };
 
 } /* namespace Aux */
 
+template<class Key, class Val>
+constexpr uint64_t Aux::PrioQueue<Key, Val>::arity;
+
+template<class Key, class Val>
+constexpr uint64_t Aux::PrioQueue<Key, Val>::notInHeap;
+
 template<class Key, class Val>
 Aux::PrioQueue<Key, Val>::PrioQueue(const std::vector<ElemType>& elems) {
-	mapValToKey.resize(elems.size());
+	position.resize(elems.size(), notInHeap);
+	heap.reserve(elems.size());
 	for (auto elem: elems) {
-		insert(elem.first, elem.second);
+		ensureCapacity(elem.second);
+		if (position[elem.second] == notInHeap) {
+			position[elem.second] = heap.size();
+			heap.push_back(elem);
+		} else {
+			heap[position[elem.second]].first = elem.first;
+		}
 	}
+	buildHeap();
 }
 
 template<class Key, class Val>
 Aux::PrioQueue<Key, Val>::PrioQueue(std::vector<Key>& keys) {
-	mapValToKey.resize(keys.size());
-	uint64_t index = 0;
-	for (auto key: keys) {
-		insert(key, index);
-		++index;
+	heap.reserve(keys.size());
+	position.resize(keys.size());
+	for (uint64_t index = 0; index < keys.size(); ++index) {
+		heap.emplace_back(keys[index], index);
+		position[index] = index;
 	}
+	buildHeap();
 }
 
 template<class Key, class Val>
 Aux::PrioQueue<Key, Val>::PrioQueue(uint64_t len) {
-	mapValToKey.resize(len);
+	position.resize(len, notInHeap);
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::siftUp(uint64_t i) {
+	ElemType elem = heap[i];
+	while (i > 0) {
+		uint64_t parent = (i - 1) / arity;
+		if (!(elem < heap[parent])) {
+			break;
+		}
+		heap[i] = heap[parent];
+		position[heap[i].second] = i;
+		i = parent;
+	}
+	heap[i] = elem;
+	position[elem.second] = i;
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::siftDown(uint64_t i) {
+	ElemType elem = heap[i];
+	const uint64_t n = heap.size();
+	while (true) {
+		uint64_t first = arity * i + 1;
+		if (first >= n) {
+			break;
+		}
+		uint64_t last = std::min(first + arity, n);
+		uint64_t minChild = first;
+		for (uint64_t c = first + 1; c < last; ++c) {
+			if (heap[c] < heap[minChild]) {
+				minChild = c;
+			}
+		}
+		if (!(heap[minChild] < elem)) {
+			break;
+		}
+		heap[i] = heap[minChild];
+		position[heap[i].second] = i;
+		i = minChild;
+	}
+	heap[i] = elem;
+	position[elem.second] = i;
+}
+
+template<class Key, class Val>
+void Aux::PrioQueue<Key, Val>::buildHeap() {
+	if (heap.size() < 2) {
+		return;
+	}
+	for (uint64_t i = (heap.size() - 2) / arity + 1; i-- > 0; ) {
+		siftDown(i);
+	}
+}
+
+template<class Key, class Val>
+inline void Aux::PrioQueue<Key, Val>::ensureCapacity(Val value) {
+	if (value >= position.size()) {
+		uint64_t doubledSize = std::max<uint64_t>(2 * position.size(), value + 1);
+		position.resize(doubledSize, notInHeap);
+	}
 }
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::insert(Key key, Val value) {
-	if (value >= mapValToKey.size()) {
-		uint64_t doubledSize = 2 * mapValToKey.size();
-		assert(value < doubledSize);
-		mapValToKey.resize(doubledSize);
+	ensureCapacity(value);
+	if (position[value] != notInHeap) {
+		decreaseKey(key, value);
+		return;
 	}
-	pqset.insert(std::make_pair(key, value));
-	mapValToKey.at(value) = key;
+	position[value] = heap.size();
+	heap.emplace_back(key, value);
+	siftUp(heap.size() - 1);
 }
 
 template<class Key, class Val>
@@ -150,43 +237,66 @@ inline void Aux::PrioQueue<Key, Val>::remove(const ElemType& elem) {
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::remove(const Val& val) {
-	Key key = mapValToKey.at(val);
-//	DEBUG("key: ", key);
-	pqset.erase(std::make_pair(key, val));
-	mapValToKey.at(val) = undefined;
+	if (val >= position.size() || position[val] == notInHeap) {
+		return;
+	}
+	uint64_t i = position[val];
+	position[val] = notInHeap;
+	ElemType last = heap.back();
+	heap.pop_back();
+	if (i < heap.size()) {
+		// move the last element into the hole and restore the heap property in either direction
+		ElemType removed = heap[i];
+		heap[i] = last;
+		position[last.second] = i;
+		if (last < removed) {
+			siftUp(i);
+		} else {
+			siftDown(i);
+		}
+	}
 }
 
 template<class Key, class Val>
 std::pair<Key, Val> Aux::PrioQueue<Key, Val>::extractMin() {
-	assert(pqset.size() > 0);
-	ElemType elem = (* pqset.begin());
-	remove(elem);
+	assert(heap.size() > 0);
+	ElemType elem = heap.front();
+	remove(elem.second);
 	return elem;
 }
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::decreaseKey(Key newKey, Val value) {
-	// find and remove element with given key
-	remove(value);
-
-	// insert element with new value
-	insert(newKey, value);
+	ensureCapacity(value);
+	uint64_t i = position[value];
+	if (i == notInHeap) {
+		insert(newKey, value);
+		return;
+	}
+	// the key may also grow, as with the former remove-and-insert implementation
+	Key oldKey = heap[i].first;
+	heap[i].first = newKey;
+	if (newKey < oldKey) {
+		siftUp(i);
+	} else {
+		siftDown(i);
+	}
 }
 
 template<class Key, class Val>
 inline uint64_t Aux::PrioQueue<Key, Val>::size() const {
-	return pqset.size();
+	return heap.size();
 }
 
 template<class Key, class Val>
 inline std::set<std::pair<Key, Val>> Aux::PrioQueue<Key, Val>::content() const {
-	return pqset;
+	return std::set<ElemType>(heap.begin(), heap.end());
 }
 
 template<class Key, class Val>
 inline void Aux::PrioQueue<Key, Val>::clear() {
-	pqset.clear();
-	mapValToKey.clear();
+	heap.clear();
+	position.clear();
 }
 
 
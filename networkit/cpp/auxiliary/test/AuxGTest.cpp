@@ -16,12 +16,14 @@
 #include <thread>
 #include <fstream>
 #include <set>
+#include <map>
 
 #include "../Log.h"
 #include "../Random.h"
 #include "../Timer.h"
 #include "../MissingMath.h"
 #include "../PrioQueue.h"
+#include "../HashAccumulator.h"
 #include "../PrioQueueForInts.h"
 #include "../StringTools.h"
 #include "../SetIntersector.h"
@@ -217,6 +219,124 @@ TEST_F(AuxGTest, testPriorityQueue) {
 	EXPECT_EQ(pq.size(), vec.size() - 5);
 }
 
+TEST_F(AuxGTest, testPriorityQueueRandomOperations) {
+	// compare against a std::set of key-value pairs under random inserts, key changes and removals
+	const uint64_t n = 1000;
+	Aux::PrioQueue<double, uint64_t> pq(n);
+	std::set<std::pair<double, uint64_t>> reference;
+	std::vector<double> keys(n, -1.0);
+
+	for (uint64_t step = 0; step < 20000; ++step) {
+		uint64_t v = Aux::Random::integer(n - 1);
+		double key = Aux::Random::integer(100); // many equal keys, ties are broken by value
+		switch (Aux::Random::integer(3)) {
+		case 0:
+		case 1:
+			if (keys[v] >= 0.0) {
+				reference.erase(std::make_pair(keys[v], v));
+			}
+			pq.decreaseKey(key, v);
+			reference.insert(std::make_pair(key, v));
+			keys[v] = key;
+			break;
+		case 2:
+			if (keys[v] >= 0.0) {
+				reference.erase(std::make_pair(keys[v], v));
+				keys[v] = -1.0;
+			}
+			pq.remove(v);
+			break;
+		default:
+			if (!reference.empty()) {
+				auto expected = *reference.begin();
+				reference.erase(reference.begin());
+				keys[expected.second] = -1.0;
+				EXPECT_EQ(expected, pq.extractMin());
+			}
+		}
+		ASSERT_EQ(reference.size(), pq.size());
+	}
+	EXPECT_EQ(reference, pq.content());
+
+	while (!reference.empty()) {
+		EXPECT_EQ(*reference.begin(), pq.extractMin());
+		reference.erase(reference.begin());
+	}
+	EXPECT_EQ(0u, pq.size());
+}
+
+TEST_F(AuxGTest, benchmarkPriorityQueue) {
+	// Dijkstra-like access pattern: build from all keys, then alternate extract-min and decrease-key.
+	// The candidate updates are drawn up front and replayed against both structures; since both extract
+	// the smallest (key, value) pair, they perform exactly the same sequence of operations.
+	const uint64_t n = 1000000;
+	const uint64_t updatesPerExtraction = 4;
+	std::vector<std::pair<uint64_t, double>> updates(n * updatesPerExtraction);
+	for (auto& update : updates) {
+		update = std::make_pair(Aux::Random::integer(n - 1), Aux::Random::real());
+	}
+	std::vector<double> keys(n);
+	std::vector<bool> extracted(n);
+	auto reset = [&]() {
+		std::fill(keys.begin(), keys.end(), std::numeric_limits<double>::max());
+		keys[0] = 0.0;
+		std::fill(extracted.begin(), extracted.end(), false);
+	};
+	Aux::Timer timer;
+
+	reset();
+	uint64_t heapOps = 0;
+	uint64_t heapChecksum = 0;
+	timer.start();
+	Aux::PrioQueue<double, uint64_t> pq(keys);
+	for (uint64_t round = 0; pq.size() > 0; ++round) {
+		auto elem = pq.extractMin();
+		extracted[elem.second] = true;
+		heapChecksum = heapChecksum * 31 + elem.second;
+		for (uint64_t i = round * updatesPerExtraction; i < (round + 1) * updatesPerExtraction; ++i) {
+			uint64_t v = updates[i].first;
+			double key = elem.first + updates[i].second;
+			if (!extracted[v] && key < keys[v]) {
+				keys[v] = key;
+				pq.decreaseKey(key, v);
+				++heapOps;
+			}
+		}
+	}
+	timer.stop();
+	INFO("d-ary heap PrioQueue finished ", heapOps, " decrease-key operations after ", timer.elapsedTag());
+
+	reset();
+	uint64_t setOps = 0;
+	uint64_t setChecksum = 0;
+	timer.start();
+	std::set<std::pair<double, uint64_t>> pqset;
+	for (uint64_t v = 0; v < n; ++v) {
+		pqset.insert(std::make_pair(keys[v], v));
+	}
+	for (uint64_t round = 0; !pqset.empty(); ++round) {
+		auto elem = *pqset.begin();
+		pqset.erase(pqset.begin());
+		extracted[elem.second] = true;
+		setChecksum = setChecksum * 31 + elem.second;
+		for (uint64_t i = round * updatesPerExtraction; i < (round + 1) * updatesPerExtraction; ++i) {
+			uint64_t v = updates[i].first;
+			double key = elem.first + updates[i].second;
+			if (!extracted[v] && key < keys[v]) {
+				pqset.erase(std::make_pair(keys[v], v));
+				keys[v] = key;
+				pqset.insert(std::make_pair(key, v));
+				++setOps;
+			}
+		}
+	}
+	timer.stop();
+	INFO("std::set reference finished ", setOps, " decrease-key operations after ", timer.elapsedTag());
+
+	EXPECT_EQ(heapOps, setOps);
+	EXPECT_EQ(heapChecksum, setChecksum);
+}
+
 TEST_F(AuxGTest, testPrioQueueForInts) {
 	// fill vector with priorities
 	std::vector<uint64_t> vec;
@@ -539,6 +659,36 @@ TEST_F(AuxGTest, testNumberParsingAdvancedReal) {
 #undef TEST_CASE_REAL
 }
 
+TEST_F(AuxGTest, testHashAccumulator) {
+	Aux::HashAccumulator<double> acc;
+	for (uint64_t round = 0; round < 100; ++round) {
+		uint64_t keys = Aux::Random::integer(1, 200);
+		acc.reset(keys);
+		std::map<uint64_t, double> expected;
+		std::vector<uint64_t> order;
+		for (uint64_t i = 0; i < 5 * keys; ++i) {
+			// spread the keys over a large range, but only use a few of them
+			uint64_t key = (i % keys) * 1000003 + round;
+			double value = Aux::Random::real();
+			if (!expected.count(key)) {
+				order.push_back(key);
+			}
+			expected[key] += value;
+			acc.add(key, value);
+		}
+		EXPECT_EQ(keys, acc.size());
+		EXPECT_EQ(0.0, acc.get(1000003 * keys + round));
+
+		uint64_t i = 0;
+		acc.forEntries([&](uint64_t key, double value) {
+			EXPECT_EQ(order[i++], key);
+			EXPECT_DOUBLE_EQ(expected[key], value);
+			EXPECT_DOUBLE_EQ(expected[key], acc.get(key));
+		});
+		EXPECT_EQ(keys, i);
+	}
+}
+
 TEST_F(AuxGTest, testBloomFilter) {
 	Aux::Random::setSeed(1, false);
 	Aux::BloomFilter bf(5);
@@ -8,6 +8,9 @@
 #include <stack>
 #include <queue>
 #include <memory>
+#include <atomic>
+#include <algorithm>
+#include <functional>
 #include <omp.h>
 
 
@@ -21,10 +24,180 @@
 
 namespace NetworKit {
 
-Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentrality) : Centrality(G, normalized, computeEdgeCentrality) {
+Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentrality) : Centrality(G, normalized, computeEdgeCentrality), concurrentSources(0) {
 
 }
 
+namespace {
+
+/**
+ * Per-source state of Brandes' algorithm, reset only at the reached nodes after every source.
+ */
+struct Workspace {
+	std::vector<edgeweight> distance;
+	std::vector<bigfloat> paths;
+	std::vector<double> dependency;
+	std::vector<std::atomic<bool>> visited;
+	std::vector<node> order; // reached nodes in nondecreasing distance from the source
+	std::vector<index> levelBegin; // BFS only: position of every level in order
+	std::vector<std::vector<node>> nextLevel; // BFS only: nodes of the next level found by every thread
+	std::vector<std::pair<edgeweight, node>> heap; // Dijkstra only
+
+	explicit Workspace(count z) : distance(z, std::numeric_limits<edgeweight>::max()), paths(z, 0), dependency(z, 0.0), visited(z) {
+		for (auto& v : visited) {
+			v.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	void reset() {
+		for (node u : order) {
+			distance[u] = std::numeric_limits<edgeweight>::max();
+			paths[u] = 0;
+			dependency[u] = 0.0;
+			visited[u].store(false, std::memory_order_relaxed);
+		}
+		order.clear();
+		levelBegin.clear();
+		for (auto& local : nextLevel) {
+			local.clear();
+		}
+		heap.clear();
+	}
+};
+
+double pathRatio(const Workspace& ws, node p, node t) {
+	// workaround for integer overflow in large graphs
+	bigfloat tmp = ws.paths[p] / ws.paths[t];
+	double weight;
+	tmp.ToDouble(weight);
+	return weight;
+}
+
+/**
+ * Adds the dependencies of source @a s to @a scores (and @a edgeScores, if not null) for an unweighted graph.
+ * The levels of the BFS are processed one after the other, in parallel if @a parallel is true.
+ */
+void accumulateBFS(const Graph& G, node s, Workspace& ws, std::vector<double>& scores, std::vector<double>* edgeScores, bool parallel) {
+	const count threads = parallel ? omp_get_max_threads() : 1;
+	if (ws.nextLevel.size() < threads) {
+		ws.nextLevel.resize(threads);
+	}
+	ws.distance[s] = 0;
+	ws.paths[s] = 1;
+	ws.visited[s] = true;
+	ws.order.push_back(s);
+	ws.levelBegin.push_back(0);
+	ws.levelBegin.push_back(1);
+
+	for (count d = 0; ws.levelBegin[d] < ws.levelBegin[d + 1]; ++d) {
+		const index begin = ws.levelBegin[d];
+		const index end = ws.levelBegin[d + 1];
+		// discover the next level, every node is claimed by exactly one thread
+		#pragma omp parallel for schedule(guided) if(parallel)
+		for (index i = begin; i < end; ++i) {
+			std::vector<node>& local = ws.nextLevel[omp_get_thread_num()];
+			G.forNeighborsOf(ws.order[i], [&](node v) {
+				if (!ws.visited[v].load(std::memory_order_relaxed) && !ws.visited[v].exchange(true)) {
+					ws.distance[v] = d + 1;
+					local.push_back(v);
+				}
+			});
+		}
+		for (auto& local : ws.nextLevel) {
+			ws.order.insert(ws.order.end(), local.begin(), local.end());
+			local.clear();
+		}
+		ws.levelBegin.push_back(ws.order.size());
+		// pull the number of shortest paths from the predecessors
+		#pragma omp parallel for schedule(guided) if(parallel)
+		for (index i = end; i < ws.order.size(); ++i) {
+			node v = ws.order[i];
+			G.forInEdgesOf(v, [&](node v, node p) {
+				if (ws.distance[p] == d) {
+					ws.paths[v] += ws.paths[p];
+				}
+			});
+		}
+	}
+
+	// accumulate dependencies in order of decreasing distance, pulled from the successors
+	const count levels = ws.levelBegin.size() - 1;
+	for (index d = levels - 1; d-- > 0; ) {
+		#pragma omp parallel for schedule(guided) if(parallel)
+		for (index i = ws.levelBegin[d]; i < ws.levelBegin[d + 1]; ++i) {
+			node p = ws.order[i];
+			double dependency = 0.0;
+			G.forEdgesOf(p, [&](node p, node t, edgeweight w, edgeid eid) {
+				if (ws.distance[t] == d + 1) {
+					double c = pathRatio(ws, p, t) * (1 + ws.dependency[t]);
+					dependency += c;
+					if (edgeScores != nullptr) {
+						#pragma omp atomic
+						(*edgeScores)[eid] += c;
+					}
+				}
+			});
+			ws.dependency[p] = dependency;
+			if (p != s) {
+				#pragma omp atomic
+				scores[p] += dependency;
+			}
+		}
+	}
+}
+
+/**
+ * Adds the dependencies of source @a s to @a scores (and @a edgeScores, if not null) for a weighted graph.
+ */
+void accumulateDijkstra(const Graph& G, node s, Workspace& ws, std::vector<double>& scores, std::vector<double>* edgeScores) {
+	auto later = std::greater<std::pair<edgeweight, node>>();
+	ws.distance[s] = 0;
+	ws.paths[s] = 1;
+	ws.heap.emplace_back(0, s);
+	while (!ws.heap.empty()) {
+		std::pop_heap(ws.heap.begin(), ws.heap.end(), later);
+		node u = ws.heap.back().second;
+		edgeweight d = ws.heap.back().first;
+		ws.heap.pop_back();
+		if (ws.visited[u] || d > ws.distance[u]) {
+			continue; // outdated entry
+		}
+		ws.visited[u] = true;
+		ws.order.push_back(u);
+		G.forEdgesOf(u, [&](node u, node v, edgeweight w) {
+			edgeweight candidate = ws.distance[u] + w;
+			if (candidate < ws.distance[v]) {
+				ws.distance[v] = candidate;
+				ws.paths[v] = ws.paths[u];
+				ws.heap.emplace_back(candidate, v);
+				std::push_heap(ws.heap.begin(), ws.heap.end(), later);
+			} else if (candidate == ws.distance[v]) {
+				ws.paths[v] += ws.paths[u];
+			}
+		});
+	}
+
+	for (index i = ws.order.size(); i-- > 0; ) {
+		node p = ws.order[i];
+		G.forEdgesOf(p, [&](node p, node t, edgeweight w, edgeid eid) {
+			if (ws.distance[t] == ws.distance[p] + w) {
+				double c = pathRatio(ws, p, t) * (1 + ws.dependency[t]);
+				ws.dependency[p] += c;
+				if (edgeScores != nullptr) {
+					#pragma omp atomic
+					(*edgeScores)[eid] += c;
+				}
+			}
+		});
+		if (p != s) {
+			#pragma omp atomic
+			scores[p] += ws.dependency[p];
+		}
+	}
+}
+
+} // namespace
+
 void Betweenness::run() {
 	Aux::SignalHandler handler;
 	count z = G.upperNodeIdBound();
@@ -36,6 +209,11 @@ void Betweenness::run() {
 		edgeScoreData.resize(z2);
 	}
 
+	if (concurrentSources > 0) {
+		runMemoryBounded();
+		return;
+	}
+
 	// thread-local scores for efficient parallelism
 	count maxThreads = omp_get_max_threads();
 	std::vector<std::vector<double> > scorePerThread(maxThreads, std::vector<double>(G.upperNodeIdBound()));
@@ -101,6 +279,56 @@ void Betweenness::run() {
 			}
 		}
 	}
+	normalize();
+
+	hasRun = true;
+}
+
+void Betweenness::runMemoryBounded() {
+	Aux::SignalHandler handler;
+	if (computeEdgeCentrality && !G.hasEdgeIds()) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+	std::vector<double>* edgeScores = computeEdgeCentrality ? &edgeScoreData : nullptr;
+	const count z = G.upperNodeIdBound();
+	std::vector<node> sources;
+	sources.reserve(G.numberOfNodes());
+	G.forNodes([&](node s) {
+		sources.push_back(s);
+	});
+
+	if (concurrentSources == 1 && !G.isWeighted()) {
+		Workspace ws(z);
+		for (node s : sources) {
+			handler.assureRunning();
+			accumulateBFS(G, s, ws, scoreData, edgeScores, true);
+			ws.reset();
+		}
+	} else {
+		std::vector<std::unique_ptr<Workspace>> workspaces(concurrentSources);
+		#pragma omp parallel for schedule(dynamic) num_threads(concurrentSources)
+		for (index i = 0; i < sources.size(); ++i) {
+			if (!handler.isRunning()) continue;
+			std::unique_ptr<Workspace>& ws = workspaces[omp_get_thread_num()];
+			if (!ws) {
+				ws.reset(new Workspace(z));
+			}
+			if (G.isWeighted()) {
+				accumulateDijkstra(G, sources[i], *ws, scoreData, edgeScores);
+			} else {
+				accumulateBFS(G, sources[i], *ws, scoreData, edgeScores, false);
+			}
+			ws->reset();
+		}
+	}
+	handler.assureRunning();
+
+	normalize();
+
+	hasRun = true;
+}
+
+void Betweenness::normalize() {
 	if (normalized) {
 		// divide by the number of possible pairs
 		count n = G.numberOfNodes();
@@ -120,7 +348,10 @@ void Betweenness::run() {
 		}
 	}
 
-	hasRun = true;
+}
+
+void Betweenness::setMemoryBounded(count concurrentSources) {
+	this->concurrentSources = concurrentSources;
 }
 
 double Betweenness::maximum(){
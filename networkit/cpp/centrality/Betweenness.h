@@ -40,6 +40,25 @@ public:
 	*/
 	double maximum();
 
+	/**
+	 * Bounds the memory of run() by processing at most @a concurrentSources sources at the same time.
+	 * Each of them uses a workspace of O(n) that is reused for all of its sources, and the dependencies
+	 * are added atomically to the shared score arrays, so the memory does not grow with the number of threads.
+	 * With one concurrent source on an unweighted graph, all threads work on the same source: the BFS
+	 * and the dependency accumulation are parallelized over the nodes of each level. On weighted graphs,
+	 * the sources themselves have to run in parallel, so @a concurrentSources should be the number of threads.
+	 *
+	 * @param concurrentSources Number of sources processed at the same time, 0 (the default) disables the
+	 * memory-bounded mode. Then every thread has its own score arrays and SSSP data.
+	 */
+	void setMemoryBounded(count concurrentSources);
+
+private:
+	count concurrentSources;
+
+	void runMemoryBounded();
+	void normalize();
+
 };
 
 } /* namespace NetworKit */
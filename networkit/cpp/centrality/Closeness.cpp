@@ -15,6 +15,7 @@
 #include "../graph/SSSP.h"
 #include "../graph/Dijkstra.h"
 #include "../graph/BFS.h"
+#include "../graph/MultiSourceBFS.h"
 #include "../components/ConnectedComponents.h"
 
 
@@ -37,26 +38,33 @@ void Closeness::run() {
 	scoreData.resize(z);
 	edgeweight infDist = std::numeric_limits<edgeweight>::max();
 
-	G.parallelForNodes([&](node s) {
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
-		sssp->run();
+	if (G.isWeighted()) {
+		G.parallelForNodes([&](node s) {
+			Dijkstra sssp(G, s, false, false);
+			sssp.run();
 
-		std::vector<edgeweight> distances = sssp->getDistances();
+			std::vector<edgeweight> distances = sssp.getDistances();
 
-		double sum = 0;
-		for (auto dist : distances) {
-			if (dist != infDist ) {
-				sum += dist;
+			double sum = 0;
+			for (auto dist : distances) {
+				if (dist != infDist ) {
+					sum += dist;
+				}
 			}
+			scoreData[s] = 1 / sum;
+		});
+	} else {
+		// unweighted: run the searches of 64 sources at once
+		std::vector<node> sources = G.nodes();
+		std::vector<double> sums(sources.size(), 0.0);
+		MultiSourceBFS msbfs(G);
+		msbfs.run(sources, [&](index i, node, count dist) {
+			sums[i] += dist;
+		});
+		for (index i = 0; i < sources.size(); ++i) {
+			scoreData[sources[i]] = 1 / sums[i];
 		}
-		scoreData[s] = 1 / sum;
-
-	});
+	}
 	if (normalized) {
 		G.forNodes([&](node u){
 			scoreData[u] = scoreData[u] * (G.numberOfNodes() - 1);
@@ -0,0 +1,321 @@
+/*
+ * KadabraBetweenness.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "KadabraBetweenness.h"
+#include "../auxiliary/Random.h"
+#include "../distance/Diameter.h"
+#include "../graph/Sampling.h"
+#include "../auxiliary/Log.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <math.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <omp.h>
+
+namespace NetworKit {
+
+/**
+ * Distances and numbers of shortest paths of the two searches of a bidirectional BFS,
+ * reset only at the touched nodes after every sample.
+ */
+struct KadabraBetweenness::Workspace {
+	std::vector<count> distS; // distance from the source
+	std::vector<count> distT; // distance to the target
+	std::vector<double> sigmaS;
+	std::vector<double> sigmaT;
+	std::vector<node> frontS;
+	std::vector<node> frontT;
+	std::vector<node> next;
+	std::vector<node> touched;
+
+	explicit Workspace(count z) : distS(z, none), distT(z, none), sigmaS(z, 0), sigmaT(z, 0) {
+	}
+
+	void reset() {
+		for (node u : touched) {
+			distS[u] = none;
+			distT[u] = none;
+			sigmaS[u] = 0;
+			sigmaT[u] = 0;
+		}
+		frontS.clear();
+		frontT.clear();
+		touched.clear();
+	}
+};
+
+KadabraBetweenness::KadabraBetweenness(const Graph& G, double epsilon, double delta, count diameterSamples) : Centrality(G, true), epsilon(epsilon), delta(delta), diameterSamples(diameterSamples), tau(0), omega(0) {
+	if (G.isWeighted()) {
+		throw std::runtime_error("KadabraBetweenness only supports unweighted graphs");
+	}
+}
+
+void KadabraBetweenness::run() {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	scoreData.clear();
+	scoreData.resize(z);
+	tau = 0;
+	omega = 0;
+	if (G.numberOfNodes() < 2) {
+		hasRun = true;
+		return;
+	}
+
+	const double c = 0.5; // universal positive constant, as in ApproxBetweenness
+	edgeweight vd = 0;
+	if (diameterSamples == 0) {
+		INFO("estimating vertex diameter pedantically");
+		vd = Diameter::estimatedVertexDiameterPedantic(G);
+	} else {
+		INFO("estimating vertex diameter roughly");
+		vd = Diameter::estimatedVertexDiameter(G, diameterSamples);
+	}
+	// half of delta is spent on this bound, the other half on the adaptive stopping condition
+	omega = ceil((c / (epsilon * epsilon)) * (floor(log2(std::max(vd - 2, 1.0))) + 1 + log(2 / delta)));
+	INFO("taking at most ", omega, " path samples");
+
+	const count maxThreads = omp_get_max_threads();
+	std::vector<std::unique_ptr<Workspace>> workspaces(maxThreads);
+	std::vector<std::vector<node>> sampledPerThread(maxThreads);
+	std::vector<count> counts(z, 0);
+
+	auto sampleRound = [&](count samples) {
+		#pragma omp parallel
+		{
+			std::unique_ptr<Workspace>& ws = workspaces[omp_get_thread_num()];
+			if (!ws) {
+				ws.reset(new Workspace(z));
+			}
+			std::vector<node>& sampled = sampledPerThread[omp_get_thread_num()];
+			#pragma omp for schedule(dynamic, 16)
+			for (index i = 0; i < samples; ++i) {
+				if (!handler.isRunning()) continue;
+				samplePath(*ws, sampled);
+			}
+		}
+		// add up the thread-local samples
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (index t = 0; t < sampledPerThread.size(); ++t) {
+			for (node v : sampledPerThread[t]) {
+				#pragma omp atomic
+				counts[v]++;
+			}
+			sampledPerThread[t].clear();
+		}
+	};
+
+	// the confidence of every node is derived from a first estimate of its betweenness
+	const count initialSamples = std::max<count>(omega / 100, 1);
+	sampleRound(initialSamples);
+	handler.assureRunning();
+	std::vector<double> deltaLower, deltaUpper;
+	computeDeltas(counts, initialSamples, deltaLower, deltaUpper);
+	std::fill(counts.begin(), counts.end(), 0);
+
+	// rounds grow with the number of samples, so at most 5% more samples than necessary are taken
+	const count minRound = std::max<count>(initialSamples, 16 * maxThreads);
+	while (tau < omega) {
+		count round = std::min(omega - tau, std::max(minRound, tau / 20));
+		sampleRound(round);
+		handler.assureRunning();
+		tau += round;
+		if (converged(counts, deltaLower, deltaUpper)) {
+			break;
+		}
+	}
+	INFO("stopped after ", tau, " path samples");
+
+	G.parallelForNodes([&](node v) {
+		scoreData[v] = counts[v] / (double) tau;
+	});
+
+	hasRun = true;
+}
+
+void KadabraBetweenness::samplePath(Workspace& ws, std::vector<node>& sampled) const {
+	node s = Sampling::randomNode(G);
+	node t;
+	do {
+		t = Sampling::randomNode(G);
+	} while (t == s);
+
+	ws.distS[s] = 0;
+	ws.sigmaS[s] = 1;
+	ws.frontS.push_back(s);
+	ws.distT[t] = 0;
+	ws.sigmaT[t] = 1;
+	ws.frontT.push_back(t);
+	ws.touched.push_back(s);
+	ws.touched.push_back(t);
+
+	// expand the side with the smaller frontier volume until the searches meet
+	bool forward = true;
+	bool met = false;
+	while (!met && !ws.frontS.empty() && !ws.frontT.empty()) {
+		count volumeS = 0;
+		for (node u : ws.frontS) {
+			volumeS += G.degreeOut(u);
+		}
+		count volumeT = 0;
+		for (node u : ws.frontT) {
+			volumeT += G.degreeIn(u);
+		}
+		forward = volumeS <= volumeT;
+
+		std::vector<node>& front = forward ? ws.frontS : ws.frontT;
+		std::vector<count>& dist = forward ? ws.distS : ws.distT;
+		std::vector<count>& otherDist = forward ? ws.distT : ws.distS;
+		std::vector<double>& sigma = forward ? ws.sigmaS : ws.sigmaT;
+		ws.next.clear();
+		for (node u : front) {
+			auto relax = [&](node v) {
+				if (dist[v] == none) {
+					if (otherDist[v] == none) {
+						ws.touched.push_back(v);
+					} else {
+						met = true;
+					}
+					dist[v] = dist[u] + 1;
+					ws.next.push_back(v);
+				}
+				if (dist[v] == dist[u] + 1) {
+					sigma[v] += sigma[u];
+				}
+			};
+			if (forward) {
+				G.forNeighborsOf(u, relax);
+			} else {
+				G.forInNeighborsOf(u, relax);
+			}
+		}
+		front.swap(ws.next);
+	}
+
+	if (met) {
+		// all shortest paths pass through exactly one node of the new frontier that was reached by both searches
+		const std::vector<node>& front = forward ? ws.frontS : ws.frontT;
+		double total = 0;
+		for (node v : front) {
+			if (ws.distS[v] != none && ws.distT[v] != none) {
+				total += ws.sigmaS[v] * ws.sigmaT[v];
+			}
+		}
+		double r = Aux::Random::real(total);
+		double sum = 0;
+		node middle = none;
+		for (node v : front) {
+			if (ws.distS[v] != none && ws.distT[v] != none) {
+				sum += ws.sigmaS[v] * ws.sigmaT[v];
+				middle = v;
+				if (sum > r) {
+					break;
+				}
+			}
+		}
+		if (middle != s && middle != t) {
+			sampled.push_back(middle);
+		}
+
+		// pick every predecessor with probability sigma(p) / sigma(v)
+		auto walk = [&](node v, std::vector<count>& dist, std::vector<double>& sigma, bool towardsSource) {
+			while (dist[v] > 0) {
+				double r = Aux::Random::real(sigma[v]);
+				double sum = 0;
+				node chosen = none;
+				auto choose = [&](node p) {
+					if (dist[p] != none && dist[p] + 1 == dist[v] && sum <= r) {
+						sum += sigma[p];
+						chosen = p;
+					}
+				};
+				if (towardsSource) {
+					G.forInNeighborsOf(v, choose);
+				} else {
+					G.forNeighborsOf(v, choose);
+				}
+				v = chosen;
+				if (dist[v] > 0) {
+					sampled.push_back(v);
+				}
+			}
+		};
+		walk(middle, ws.distS, ws.sigmaS, true);
+		walk(middle, ws.distT, ws.sigmaT, false);
+	}
+	ws.reset();
+}
+
+void KadabraBetweenness::computeDeltas(const std::vector<count>& counts, count samples, std::vector<double>& deltaLower, std::vector<double>& deltaUpper) const {
+	const count z = G.upperNodeIdBound();
+	const double n = G.numberOfNodes();
+	const double balancing = 0.001; // share of delta spread evenly over all nodes
+	std::vector<double> estimate(z, 0.0);
+	G.parallelForNodes([&](node v) {
+		estimate[v] = std::max<count>(counts[v], 1) / (double) samples;
+	});
+
+	// find the smallest C with sum_v exp(-C epsilon^2 / b(v)) < delta / 4 (1 - balancing) by bisection
+	auto failure = [&](double C) {
+		double sum = 0;
+		#pragma omp parallel for reduction(+:sum)
+		for (index v = 0; v < z; ++v) {
+			if (G.hasNode(v)) {
+				sum += exp(-C * epsilon * epsilon / estimate[v]);
+			}
+		}
+		return sum;
+	};
+	const double target = delta / 4 * (1 - balancing);
+	double low = 0;
+	double high = log(n / target) / (epsilon * epsilon);
+	for (count i = 0; i < 64; ++i) {
+		double mid = (low + high) / 2;
+		if (failure(mid) >= target) {
+			low = mid;
+		} else {
+			high = mid;
+		}
+	}
+
+	deltaLower.assign(z, 0.0);
+	G.parallelForNodes([&](node v) {
+		deltaLower[v] = exp(-high * epsilon * epsilon / estimate[v]) + delta * balancing / (4 * n);
+	});
+	deltaUpper = deltaLower;
+}
+
+bool KadabraBetweenness::converged(const std::vector<count>& counts, const std::vector<double>& deltaLower, const std::vector<double>& deltaUpper) const {
+	const count z = G.upperNodeIdBound();
+	const double ratio = omega / (double) tau;
+	count violated = 0;
+	#pragma omp parallel for reduction(+:violated)
+	for (index v = 0; v < z; ++v) {
+		if (!G.hasNode(v)) continue;
+		const double b = counts[v] / (double) tau;
+		const double logLower = log(1 / deltaLower[v]);
+		const double logUpper = log(1 / deltaUpper[v]);
+		// distance of the lower and the upper confidence bound from the estimate
+		const double f = logLower / tau * (1.0 / 3 - ratio + sqrt((1.0 / 3 - ratio) * (1.0 / 3 - ratio) + 2 * b * omega / logLower));
+		const double g = logUpper / tau * (1.0 / 3 + ratio + sqrt((1.0 / 3 + ratio) * (1.0 / 3 + ratio) + 2 * b * omega / logUpper));
+		if (f >= epsilon || g >= epsilon) {
+			violated++;
+		}
+	}
+	return violated == 0;
+}
+
+count KadabraBetweenness::numberOfSamples() {
+	return tau;
+}
+
+count KadabraBetweenness::maxNumberOfSamples() {
+	return omega;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,71 @@
+/*
+ * KadabraBetweenness.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef KADABRABETWEENNESS_H_
+#define KADABRABETWEENNESS_H_
+
+#include "Centrality.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Adaptive approximation of betweenness centrality according to the algorithm described in
+ * Michele Borassi and Emanuele Natale: KADABRA is an ADaptive Algorithm for Betweenness via Random Approximation
+ *
+ * Like ApproxBetweenness, it samples shortest paths between random node pairs. The sample size of
+ * ApproxBetweenness is only used as an upper bound: after every round of samples the algorithm checks
+ * per-node confidence intervals and stops as soon as all of them are within the error bound. Paths are
+ * sampled with a balanced bidirectional BFS, in parallel with thread-local workspaces.
+ * Only unweighted graphs are supported.
+ */
+class KadabraBetweenness: public NetworKit::Centrality {
+
+public:
+
+	/**
+	 * The algorithm approximates the betweenness of all vertices so that the scores are
+	 * within an additive error @a epsilon with probability at least (1- @a delta).
+	 * The values are normalized.
+	 *
+	 * @param	G			the graph
+	 * @param	epsilon		maximum additive error
+	 * @param	delta		probability that the values are within the error guarantee
+	 * @param	diameterSamples		if 0, use the possibly slow estimation of the vertex diameter for the
+	 * upper bound of the sample size. Otherwise, use a fast heuristic with this number of samples, see ApproxBetweenness.
+	 */
+	KadabraBetweenness(const Graph& G, double epsilon=0.01, double delta=0.1, count diameterSamples=0);
+
+	void run() override;
+
+	/**
+	 * @return number of samples the scores of the last run are based on
+	 */
+	count numberOfSamples();
+
+	/**
+	 * @return the upper bound of the number of samples in the last run, i.e. the number of samples ApproxBetweenness would take
+	 */
+	count maxNumberOfSamples();
+
+private:
+
+	double epsilon;
+	double delta;
+	count diameterSamples;
+	count tau; // number of samples taken in last run
+	count omega; // upper bound of tau
+
+	struct Workspace;
+
+	void samplePath(Workspace& ws, std::vector<node>& sampled) const;
+	void computeDeltas(const std::vector<count>& counts, count samples, std::vector<double>& deltaLower, std::vector<double>& deltaUpper) const;
+	bool converged(const std::vector<count>& counts, const std::vector<double>& deltaLower, const std::vector<double>& deltaUpper) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* KADABRABETWEENNESS_H_ */
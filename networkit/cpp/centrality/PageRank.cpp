@@ -9,10 +9,14 @@
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/SignalHandling.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
 namespace NetworKit {
 
 NetworKit::PageRank::PageRank(const Graph& G, double damp, double tol):
-		Centrality(G, true), damp(damp), tol(tol)
+		Centrality(G, true), damp(damp), tol(tol), norm(L2_NORM), maxIterations(none), gaussSeidel(false), iterations(0)
 {
 
 }
@@ -22,41 +26,23 @@ void NetworKit::PageRank::run() {
 	count n = G.numberOfNodes();
 	count z = G.upperNodeIdBound();
 	double oneOverN = 1.0 / (double) n;
-	double teleportProb = (1.0 - damp) / (double) n;
-	scoreData.resize(z, oneOverN);
-	std::vector<double> pr = scoreData;
-	bool isConverged = false;
+	scoreData.assign(z, oneOverN);
 
-	std::vector<double> deg(z, 0.0);
+	// inverse weighted out-degrees, 0 for dangling nodes
+	std::vector<double> invDeg(z, 0.0);
 	G.parallelForNodes([&](node u) {
-		deg[u] = (double) G.weightedDegree(u);
+		double deg = (double) G.weightedDegree(u);
+		if (deg > 0.0) {
+			invDeg[u] = 1.0 / deg;
+		}
 	});
 
-	while (! isConverged) {
-		handler.assureRunning();
-		G.balancedParallelForNodes([&](node u) {
-			pr[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
-				// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
-				// we follow the verbal description, which requires to sum over the incoming edges
-				pr[u] += scoreData[v] * w / deg[v];
-			});
-			pr[u] *= damp;
-			pr[u] += teleportProb;
-		});
-
-		auto converged([&]() {
-			double diff = G.parallelSumForNodes([&](node u) {
-				double d = scoreData[u] - pr[u];
-				return d * d;
-			});
-//			TRACE("sqrt(diff): ", sqrt(diff));
-			return (sqrt(diff) <= tol);
-		});
-
-		isConverged = converged();
-		scoreData = pr;
+	if (gaussSeidel) {
+		runGaussSeidel(invDeg);
+	} else {
+		runJacobi(invDeg);
 	}
+
 	handler.assureRunning();
 	// make sure scoreData sums up to 1
 	double sum = G.parallelSumForNodes([&](node u) {
@@ -70,6 +56,143 @@ void NetworKit::PageRank::run() {
 	hasRun = true;
 }
 
+double PageRank::difference(double sum, double max) const {
+	switch (norm) {
+		case L1_NORM:
+			return sum;
+		case L2_NORM:
+			return sqrt(sum);
+		default:
+			return max;
+	}
+}
+
+void PageRank::runJacobi(const std::vector<double>& invDeg) {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const double n = G.numberOfNodes();
+	const double teleportProb = (1.0 - damp) / n;
+	const bool squared = (norm == L2_NORM);
+
+	// contribution of every node to each of its out-neighbors, read by the sweep while the next ones are written
+	std::vector<double> contrib(z, 0.0);
+	std::vector<double> nextContrib(z, 0.0);
+	double dangling = 0.0;
+	#pragma omp parallel for reduction(+:dangling)
+	for (index u = 0; u < z; ++u) {
+		if (G.hasNode(u)) {
+			contrib[u] = scoreData[u] * invDeg[u];
+			if (invDeg[u] == 0.0) {
+				dangling += scoreData[u];
+			}
+		}
+	}
+
+	iterations = 0;
+	bool isConverged = false;
+	while (! isConverged) {
+		handler.assureRunning();
+		// the score of dangling nodes is distributed uniformly, like the teleport probability
+		const double base = damp * dangling / n + teleportProb;
+		double diffSum = 0.0;
+		double diffMax = 0.0;
+		double nextDangling = 0.0;
+		#pragma omp parallel for schedule(guided) reduction(+:diffSum,nextDangling) reduction(max:diffMax)
+		for (index u = 0; u < z; ++u) {
+			if (!G.hasNode(u)) {
+				continue;
+			}
+			double pulled = 0.0;
+			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
+				// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+				// we follow the verbal description, which requires to sum over the incoming edges
+				pulled += contrib[v] * w;
+			});
+			double score = damp * pulled + base;
+			double d = std::fabs(score - scoreData[u]);
+			diffSum += squared ? d * d : d;
+			diffMax = std::max(diffMax, d);
+			scoreData[u] = score;
+			nextContrib[u] = score * invDeg[u];
+			if (invDeg[u] == 0.0) {
+				nextDangling += score;
+			}
+		}
+		std::swap(contrib, nextContrib);
+		dangling = nextDangling;
+		++iterations;
+		isConverged = (difference(diffSum, diffMax) <= tol) || (iterations >= maxIterations);
+	}
+}
+
+void PageRank::runGaussSeidel(const std::vector<double>& invDeg) {
+	Aux::SignalHandler handler;
+	const count z = G.upperNodeIdBound();
+	const double n = G.numberOfNodes();
+	const double teleportProb = (1.0 - damp) / n;
+	const bool squared = (norm == L2_NORM);
+
+	// updated in place, so other threads may read a contribution while it is written
+	std::vector<std::atomic<double>> contrib(z);
+	double dangling = 0.0;
+	#pragma omp parallel for reduction(+:dangling)
+	for (index u = 0; u < z; ++u) {
+		contrib[u].store(G.hasNode(u) ? scoreData[u] * invDeg[u] : 0.0, std::memory_order_relaxed);
+		if (G.hasNode(u) && invDeg[u] == 0.0) {
+			dangling += scoreData[u];
+		}
+	}
+
+	iterations = 0;
+	bool isConverged = false;
+	while (! isConverged) {
+		handler.assureRunning();
+		// dangling nodes contribute their score of the previous sweep
+		const double base = damp * dangling / n + teleportProb;
+		double diffSum = 0.0;
+		double diffMax = 0.0;
+		double nextDangling = 0.0;
+		#pragma omp parallel for schedule(guided) reduction(+:diffSum,nextDangling) reduction(max:diffMax)
+		for (index u = 0; u < z; ++u) {
+			if (!G.hasNode(u)) {
+				continue;
+			}
+			double pulled = 0.0;
+			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
+				pulled += contrib[v].load(std::memory_order_relaxed) * w;
+			});
+			double score = damp * pulled + base;
+			double d = std::fabs(score - scoreData[u]);
+			diffSum += squared ? d * d : d;
+			diffMax = std::max(diffMax, d);
+			scoreData[u] = score;
+			contrib[u].store(score * invDeg[u], std::memory_order_relaxed);
+			if (invDeg[u] == 0.0) {
+				nextDangling += score;
+			}
+		}
+		dangling = nextDangling;
+		++iterations;
+		isConverged = (difference(diffSum, diffMax) <= tol) || (iterations >= maxIterations);
+	}
+}
+
+void PageRank::setNorm(Norm norm) {
+	this->norm = norm;
+}
+
+void PageRank::setMaxIterations(count maxIterations) {
+	this->maxIterations = maxIterations;
+}
+
+void PageRank::setGaussSeidel(bool gaussSeidel) {
+	this->gaussSeidel = gaussSeidel;
+}
+
+count PageRank::numberOfIterations() const {
+	return iterations;
+}
+
 double PageRank::maximum() {
 	return 1.0;	// upper bound, could be tighter by assuming e.g. a star graph with n nodes
 }
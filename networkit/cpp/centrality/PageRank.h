@@ -18,11 +18,30 @@ namespace NetworKit {
  * NOTE: There is an inconsistency in the definition in Newman's book (Ch. 7) regarding
  * directed graphs; we follow the verbal description, which requires to sum over the incoming
  * edges (as opposed to outgoing ones).
+ *
+ * The scores are computed by pulling the contributions score[v] / deg(v) of the in-neighbors, which are
+ * stored separately so that no division happens per edge. The score of dangling nodes (without outgoing
+ * edges) is distributed uniformly over all nodes. Optionally, Gauss-Seidel sweeps use the contributions
+ * updated earlier in the same sweep, which usually needs fewer sweeps than the default Jacobi iteration.
  */
 class PageRank: public NetworKit::Centrality {
+public:
+	/**
+	 * Norms of the score difference between two iterations, which is compared with the tolerance.
+	 */
+	enum Norm {
+		L1_NORM,
+		L2_NORM,
+		L_INF_NORM
+	};
+
 protected:
 	double damp;
 	double tol;
+	Norm norm;
+	count maxIterations;
+	bool gaussSeidel;
+	count iterations;
 
 public:
 	/**
@@ -37,6 +56,34 @@ public:
 	virtual void run();
 
 	virtual double maximum();
+
+	/**
+	 * Sets the norm of the score difference that is compared with the tolerance. Default: L2_NORM.
+	 */
+	void setNorm(Norm norm);
+
+	/**
+	 * Stops the iteration after @a maxIterations iterations even if the tolerance has not been reached.
+	 * Default: none, i.e. no limit.
+	 */
+	void setMaxIterations(count maxIterations);
+
+	/**
+	 * If @a gaussSeidel is true, the scores are updated in place (Gauss-Seidel) instead of from the
+	 * scores of the previous iteration (Jacobi). The sweeps run in parallel, so the order in which
+	 * updates become visible is not fixed and results may differ slightly between runs. Default: false.
+	 */
+	void setGaussSeidel(bool gaussSeidel);
+
+	/**
+	 * @return The number of iterations of the last run.
+	 */
+	count numberOfIterations() const;
+
+private:
+	double difference(double sum, double max) const;
+	void runJacobi(const std::vector<double>& invDeg);
+	void runGaussSeidel(const std::vector<double>& invDeg);
 };
 
 } /* namespace NetworKit */
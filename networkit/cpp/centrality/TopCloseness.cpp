@@ -0,0 +1,173 @@
+/*
+ * TopCloseness.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "TopCloseness.h"
+#include "../components/ConnectedComponents.h"
+#include "../components/StronglyConnectedComponents.h"
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/Log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <omp.h>
+
+namespace NetworKit {
+
+TopCloseness::TopCloseness(const Graph& G, count k, bool checkConnectedness) : G(G), k(k), completeSearches(0) {
+	if (G.isWeighted()) {
+		throw std::runtime_error("TopCloseness only supports unweighted graphs");
+	}
+	if (checkConnectedness) {
+		count components;
+		if (G.isDirected()) {
+			StronglyConnectedComponents scc(G);
+			scc.run();
+			components = scc.numberOfComponents();
+		} else {
+			ConnectedComponents cc(G);
+			cc.run();
+			components = cc.numberOfComponents();
+		}
+		if (components != 1) {
+			throw std::runtime_error("TopCloseness is undefined on disconnected graphs");
+		}
+	}
+}
+
+void TopCloseness::run() {
+	const count n = G.numberOfNodes();
+	const count z = G.upperNodeIdBound();
+	const count results = std::min(k, n);
+	topkNodes.clear();
+	topkScores.clear();
+	completeSearches = 0;
+	if (n < 2 || results == 0) {
+		hasRun = true;
+		return;
+	}
+
+	// the neighbors are at distance 1, all other nodes at least at distance 2
+	auto degreeBound = [&](node v) {
+		return 2 * (n - 1) - std::min(G.degreeOut(v), n - 1);
+	};
+	std::vector<node> candidates = G.nodes();
+	Aux::Parallel::sort(candidates.begin(), candidates.end(), [&](node u, node v) {
+		return G.degreeOut(u) > G.degreeOut(v) || (G.degreeOut(u) == G.degreeOut(v) && u < v);
+	});
+
+	// max-heap of the best farness values found so far
+	std::vector<std::pair<count, node>> top;
+	std::atomic<count> kth(none); // k-th best farness, none while fewer than k are known
+
+	#pragma omp parallel
+	{
+		std::vector<count> dist(z, none);
+		std::vector<node> queue;
+		queue.reserve(n);
+		count complete = 0;
+
+		/**
+		 * BFS from s that returns its farness, or none as soon as the farness cannot be lower than the k-th best.
+		 * After level l with farness sum S of the reached nodes, the next level contains at most
+		 * the number of edges leaving level l, and all remaining nodes are at distance l + 2 or more.
+		 */
+		auto farness = [&](node s) {
+			dist[s] = 0;
+			queue.push_back(s);
+			count sum = 0;
+			count result = 0;
+			index levelBegin = 0;
+			for (count level = 0; levelBegin < queue.size(); ++level) {
+				const index levelEnd = queue.size();
+				count nextBound = 0;
+				for (index i = levelBegin; i < levelEnd; ++i) {
+					// apart from the source, every node of an undirected graph has an edge back to the previous level
+					nextBound += G.degreeOut(queue[i]) - (level > 0 && !G.isDirected() ? 1 : 0);
+				}
+				const count remaining = n - levelEnd;
+				const count next = std::min(nextBound, remaining);
+				if (sum + (level + 1) * next + (level + 2) * (remaining - next) >= kth.load(std::memory_order_relaxed)) {
+					result = none;
+					break;
+				}
+				for (index i = levelBegin; i < levelEnd; ++i) {
+					G.forNeighborsOf(queue[i], [&](node v) {
+						if (dist[v] == none) {
+							dist[v] = level + 1;
+							sum += level + 1;
+							queue.push_back(v);
+						}
+					});
+				}
+				levelBegin = levelEnd;
+			}
+			for (node u : queue) {
+				dist[u] = none;
+			}
+			queue.clear();
+			return result == none ? none : sum;
+		};
+
+		#pragma omp for schedule(dynamic, 1)
+		for (index i = 0; i < candidates.size(); ++i) {
+			node s = candidates[i];
+			// the candidates are sorted by this bound, so the remaining iterations end here as well
+			if (degreeBound(s) >= kth.load(std::memory_order_relaxed)) continue;
+			count f = farness(s);
+			if (f == none) continue;
+			complete++;
+			#pragma omp critical
+			{
+				if (f < kth.load(std::memory_order_relaxed)) {
+					top.emplace_back(f, s);
+					std::push_heap(top.begin(), top.end());
+					if (top.size() > results) {
+						std::pop_heap(top.begin(), top.end());
+						top.pop_back();
+					}
+					if (top.size() == results) {
+						kth.store(top.front().first, std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+		#pragma omp atomic
+		completeSearches += complete;
+	}
+	DEBUG("complete searches: ", completeSearches, " of ", n);
+
+	std::sort(top.begin(), top.end());
+	for (auto& entry : top) {
+		topkNodes.push_back(entry.second);
+		topkScores.push_back((n - 1) / (double) entry.first);
+	}
+
+	hasRun = true;
+}
+
+std::vector<node> TopCloseness::topkNodesList() const {
+	assureFinished();
+	return topkNodes;
+}
+
+std::vector<double> TopCloseness::topkScoresList() const {
+	assureFinished();
+	return topkScores;
+}
+
+count TopCloseness::numberOfCompleteSearches() const {
+	assureFinished();
+	return completeSearches;
+}
+
+std::string TopCloseness::toString() const {
+	std::stringstream stream;
+	stream << "TopCloseness(k=" << k << ")";
+	return stream.str();
+}
+
+} /* namespace NetworKit */
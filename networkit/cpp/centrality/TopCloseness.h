@@ -0,0 +1,72 @@
+/*
+ * TopCloseness.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef TOPCLOSENESS_H_
+#define TOPCLOSENESS_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Computes the exact k nodes with the highest closeness centrality of an unweighted, (strongly) connected graph
+ * according to the BFSCut algorithm described in
+ * Elisabetta Bergamini, Michele Borassi, Pierluigi Crescenzi, Andrea Marino and Henning Meyerhenke:
+ * Computing Top-k Closeness Centrality Faster in Unweighted Graphs
+ *
+ * The candidates are processed in order of decreasing degree, in parallel. The BFS of a candidate is stopped
+ * as soon as a lower bound of its farness, computed from the nodes reached so far and the size of the next
+ * level, is not better than the k-th best farness found so far. Once even the degree-based lower bound of the
+ * next candidate cannot beat the k-th best farness, all remaining candidates are skipped.
+ */
+class TopCloseness: public Algorithm {
+
+public:
+
+	/**
+	 * @param G The graph.
+	 * @param k Number of nodes with the highest closeness to compute.
+	 * @param checkConnectedness Turn this off if you know the graph is (strongly) connected.
+	 */
+	TopCloseness(const Graph& G, count k = 1, bool checkConnectedness = true);
+
+	void run() override;
+
+	/**
+	 * @return The k nodes with the highest closeness, in decreasing order of closeness.
+	 */
+	std::vector<node> topkNodesList() const;
+
+	/**
+	 * @return The normalized closeness (n-1) / farness of the nodes of topkNodesList().
+	 */
+	std::vector<double> topkScoresList() const;
+
+	/**
+	 * @return Number of BFS runs that were not stopped early in the last run.
+	 */
+	count numberOfCompleteSearches() const;
+
+	virtual std::string toString() const override;
+
+	virtual bool isParallel() const override {
+		return true;
+	}
+
+private:
+
+	const Graph& G;
+	count k;
+	std::vector<node> topkNodes;
+	std::vector<double> topkScores;
+	count completeSearches;
+};
+
+} /* namespace NetworKit */
+
+#endif /* TOPCLOSENESS_H_ */
@@ -8,9 +8,11 @@
 #include "CentralityGTest.h"
 #include "../Betweenness.h"
 #include "../Closeness.h"
+#include "../TopCloseness.h"
 #include "../DynApproxBetweenness.h"
 #include "../ApproxBetweenness.h"
 #include "../ApproxBetweenness2.h"
+#include "../KadabraBetweenness.h"
 #include "../ApproxCloseness.h"
 #include "../EigenvectorCentrality.h"
 #include "../KatzCentrality.h"
@@ -25,6 +27,7 @@
 #include "../../structures/Cover.h"
 #include "../../structures/Partition.h"
 #include "../../auxiliary/Timer.h"
+#include "../../auxiliary/Random.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 
 
@@ -61,6 +64,37 @@ TEST_F(CentralityGTest, testBetweennessCentrality) {
 	EXPECT_NEAR(1.0, bc[5], tol);
 }
 
+TEST_F(CentralityGTest, testMemoryBoundedBetweenness) {
+	Aux::Random::setSeed(42, false);
+	Graph undirected = ErdosRenyiGenerator(300, 0.02).generate();
+	Graph directed = ErdosRenyiGenerator(300, 0.02, true).generate();
+	// small integer weights produce many shortest paths of equal length
+	Graph weighted(undirected.upperNodeIdBound(), true);
+	undirected.forEdges([&](node u, node v) {
+		weighted.addEdge(u, v, Aux::Random::integer(1, 3));
+	});
+
+	for (Graph* G : {&undirected, &directed, &weighted}) {
+		G->indexEdges();
+		Betweenness reference(*G, false, true);
+		reference.run();
+		for (count sources : {1, 3}) {
+			Betweenness bounded(*G, false, true);
+			bounded.setMemoryBounded(sources);
+			bounded.run();
+			G->forNodes([&](node u) {
+				EXPECT_NEAR(reference.score(u), bounded.score(u), 1e-6);
+			});
+			std::vector<double> expected = reference.edgeScores();
+			std::vector<double> actual = bounded.edgeScores();
+			ASSERT_EQ(expected.size(), actual.size());
+			for (index e = 0; e < expected.size(); ++e) {
+				EXPECT_NEAR(expected[e], actual[e], 1e-6);
+			}
+		}
+	}
+}
+
 
 TEST_F(CentralityGTest, testBetweenness2Centrality) {
 /* Graph:
@@ -121,6 +155,42 @@ TEST_F(CentralityGTest, testApproxBetweennessSmallGraph) {
 	DEBUG("scores: ", bc);
 }
 
+TEST_F(CentralityGTest, testKadabraBetweenness) {
+	Aux::Random::setSeed(42, true);
+	const double epsilon = 0.02;
+	const double delta = 0.1;
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(500, 0.01, directed).generate();
+		Betweenness exact(G);
+		exact.run();
+		// the approximation is the fraction of shortest paths between ordered node pairs
+		const double pairs = G.numberOfNodes() * (G.numberOfNodes() - 1.0);
+
+		KadabraBetweenness kadabra(G, epsilon, delta);
+		kadabra.run();
+		G.forNodes([&](node u) {
+			EXPECT_NEAR(exact.score(u) / pairs, kadabra.score(u), epsilon);
+		});
+		EXPECT_LT(kadabra.numberOfSamples(), kadabra.maxNumberOfSamples());
+		INFO("KADABRA stopped after ", kadabra.numberOfSamples(), " of at most ", kadabra.maxNumberOfSamples(), " samples");
+	}
+
+	// the graph of testBetweennessCentrality, divided by the 30 ordered node pairs
+	Graph G(6);
+	G.addEdge(0, 2);
+	G.addEdge(1, 2);
+	G.addEdge(2, 3);
+	G.addEdge(2, 4);
+	G.addEdge(3, 5);
+	G.addEdge(4, 5);
+	KadabraBetweenness kadabra(G, 0.01, delta);
+	kadabra.run();
+	std::vector<double> expected = {0.0, 0.0, 15.0 / 30, 3.0 / 30, 3.0 / 30, 1.0 / 30};
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(expected[u], kadabra.score(u), 0.01);
+	});
+}
+
 TEST_F(CentralityGTest, tryApproxBetweennessOnRealGraph) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/ns894786.mps.gz.variable.graph");
@@ -205,6 +275,55 @@ TEST_F(CentralityGTest, testPageRankDirected) {
 }
 
 
+TEST_F(CentralityGTest, testPageRankVariants) {
+	// sparse directed graph with many dangling nodes
+	Aux::Random::setSeed(42, false);
+	ErdosRenyiGenerator generator(500, 0.004, true);
+	Graph G = generator.generate();
+	count n = G.numberOfNodes();
+
+	// reference: power iteration with explicit handling of dangling nodes
+	double damp = 0.85;
+	std::vector<double> ref(n, 1.0 / n);
+	for (count iter = 0; iter < 300; ++iter) {
+		std::vector<double> next(n, 0.0);
+		double dangling = 0.0;
+		G.forNodes([&](node u) {
+			if (G.degree(u) == 0) {
+				dangling += ref[u];
+			}
+		});
+		G.forEdges([&](node u, node v) {
+			next[v] += ref[u] / G.degree(u);
+		});
+		G.forNodes([&](node u) {
+			next[u] = damp * (next[u] + dangling / n) + (1.0 - damp) / n;
+		});
+		ref = next;
+	}
+
+	for (PageRank::Norm norm : {PageRank::L1_NORM, PageRank::L2_NORM, PageRank::L_INF_NORM}) {
+		// the number of iterations is only comparable for the same norm
+		PageRank jacobi(G, damp, 1e-12);
+		jacobi.setNorm(norm);
+		jacobi.run();
+		PageRank gs(G, damp, 1e-12);
+		gs.setNorm(norm);
+		gs.setGaussSeidel(true);
+		gs.run();
+		EXPECT_LE(gs.numberOfIterations(), jacobi.numberOfIterations() + 1);
+		G.forNodes([&](node u) {
+			EXPECT_NEAR(ref[u], jacobi.score(u), 1e-9);
+			EXPECT_NEAR(ref[u], gs.score(u), 1e-9);
+		});
+	}
+
+	PageRank limited(G, damp, 0.0);
+	limited.setMaxIterations(5);
+	limited.run();
+	EXPECT_EQ(5u, limited.numberOfIterations());
+}
+
 TEST_F(CentralityGTest, testEigenvectorCentrality) {
  /* Graph:
     0    3   6
@@ -479,6 +598,55 @@ TEST_F(CentralityGTest, testClosenessCentrality) {
 		EXPECT_NEAR(0.2, maximum, tol);
 }
 
+TEST_F(CentralityGTest, testTopCloseness) {
+	Aux::Random::setSeed(42, false);
+	const count k = 10;
+	Graph undirected = ErdosRenyiGenerator(300, 0.05).generate();
+	// random orientations of the same edges, strongly connected by a Hamiltonian cycle
+	Graph directed(undirected.upperNodeIdBound(), false, true);
+	undirected.forEdges([&](node u, node v) {
+		if (Aux::Random::real() < 0.5) {
+			directed.addEdge(u, v);
+		} else {
+			directed.addEdge(v, u);
+		}
+	});
+	directed.forNodes([&](node u) {
+		directed.addEdge(u, (u + 1) % directed.upperNodeIdBound());
+	});
+
+	for (Graph* graph : {&undirected, &directed}) {
+		const Graph& G = *graph;
+		// Closeness does not support the connectedness check on directed graphs
+		Closeness exact(G, true, !G.isDirected());
+		exact.run();
+		std::vector<std::pair<node, double>> ranking = exact.ranking();
+
+		TopCloseness top(G, k);
+		top.run();
+		std::vector<node> nodes = top.topkNodesList();
+		std::vector<double> scores = top.topkScoresList();
+		ASSERT_EQ(k, nodes.size());
+		ASSERT_EQ(k, scores.size());
+		for (index i = 0; i < k; ++i) {
+			EXPECT_NEAR(ranking[i].second, scores[i], 1e-9);
+			EXPECT_NEAR(exact.score(nodes[i]), scores[i], 1e-9);
+		}
+		EXPECT_LT(top.numberOfCompleteSearches(), G.numberOfNodes());
+	}
+
+	// the center of a star is searched first, the degree bound of every leaf is worse than its farness
+	Graph star(20);
+	for (node u = 1; u < 20; ++u) {
+		star.addEdge(0, u);
+	}
+	TopCloseness topStar(star, 1);
+	topStar.run();
+	EXPECT_EQ(std::vector<node>{0}, topStar.topkNodesList());
+	EXPECT_NEAR(1.0, topStar.topkScoresList()[0], 1e-9);
+	EXPECT_EQ(1u, topStar.numberOfCompleteSearches());
+}
+
 
 TEST_F(CentralityGTest, testKPathCentrality) {
     METISGraphReader reader;
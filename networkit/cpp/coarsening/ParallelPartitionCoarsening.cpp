@@ -7,9 +7,11 @@
 
 #include "ParallelPartitionCoarsening.h"
 #include <omp.h>
+#include <algorithm>
 #include "../graph/GraphBuilder.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/HashAccumulator.h"
 
 namespace NetworKit {
 
@@ -98,29 +100,45 @@ void ParallelPartitionCoarsening::run() {
 		timer2.stop();
 		INFO("combining coarse graphs took ", timer2.elapsedTag());
 	} else {
-		std::vector< std::vector<node> > nodesPerSuperNode(nextNodeId);
+		// group the nodes by supernode
+		std::vector<index> begin(nextNodeId + 1, 0);
 		G.forNodes([&](node v) {
-			node sv = nodeToSuperNode[v];
-			nodesPerSuperNode[sv].push_back(v);
+			++begin[nodeToSuperNode[v] + 1];
+		});
+		for (node su = 0; su < nextNodeId; ++su) {
+			begin[su + 1] += begin[su];
+		}
+		std::vector<node> nodesPerSuperNode(begin[nextNodeId]);
+		std::vector<index> next(begin.begin(), begin.end() - 1);
+		G.forNodes([&](node v) {
+			nodesPerSuperNode[next[nodeToSuperNode[v]]++] = v;
 		});
 
 		// iterate over edges of G and create edges in coarse graph or update edge and node weights in Gcon
 		DEBUG("create edges in coarse graphs");
 		GraphBuilder b(nextNodeId, true, false);
+		// the edge weights to the neighboring supernodes are summed up in a hash table per thread, which is reused
+		std::vector<Aux::HashAccumulator<edgeweight> > outEdges(omp_get_max_threads());
 		#pragma omp parallel for schedule(guided)
 		for (node su = 0; su < nextNodeId; su++) {
-			std::map<index, edgeweight> outEdges;
-			for (node u : nodesPerSuperNode[su]) {
+			Aux::HashAccumulator<edgeweight>& acc = outEdges[omp_get_thread_num()];
+			count volume = 0;
+			for (index i = begin[su]; i < begin[su + 1]; ++i) {
+				volume += G.degree(nodesPerSuperNode[i]);
+			}
+			acc.reset(std::min(volume, nextNodeId));
+			for (index i = begin[su]; i < begin[su + 1]; ++i) {
+				node u = nodesPerSuperNode[i];
 				G.forNeighborsOf(u, [&](node v, edgeweight ew) {
 					node sv = nodeToSuperNode[v];
 					if (su != sv || u >= v) { // count edges inside uv only once (we iterate over them twice)
-						outEdges[sv] += ew;
+						acc.add(sv, ew);
 					}
 				});
 			}
-			for (auto it : outEdges) {
-				b.addHalfEdge(su, it.first, it.second);
-			}
+			acc.forEntries([&](node sv, edgeweight ew) {
+				b.addHalfEdge(su, sv, ew);
+			});
 		}
 
 		Gcombined = b.toGraph(false);
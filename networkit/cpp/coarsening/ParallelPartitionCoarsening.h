@@ -19,6 +19,12 @@ namespace NetworKit {
  */
 class ParallelPartitionCoarsening: public NetworKit::GraphCoarsening {
 public:
+	/**
+	 * @param G The graph.
+	 * @param zeta The partition whose subsets become the supernodes.
+	 * @param useGraphBuilder If @c true, the edges of every supernode are aggregated in a hash table and the coarse
+	 * graph is assembled with a GraphBuilder, otherwise every thread contracts into its own copy of the coarse graph.
+	 */
 	ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder = true);
 
 	virtual void run();
@@ -0,0 +1,137 @@
+/*
+ * ContingencyTable.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "ContingencyTable.h"
+#include "../auxiliary/HashAccumulator.h"
+#include "../auxiliary/Parallel.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <omp.h>
+
+namespace NetworKit {
+
+ContingencyTable::ContingencyTable(const Partition& zeta, const Partition& eta) {
+	build(zeta, eta, std::max(zeta.numberOfElements(), eta.numberOfElements()), [&](index e) {
+		return zeta.contains(e) && eta.contains(e);
+	});
+}
+
+ContingencyTable::ContingencyTable(const Graph& G, const Partition& zeta, const Partition& eta) {
+	build(zeta, eta, G.upperNodeIdBound(), [&](node u) {
+		if (!G.hasNode(u)) {
+			return false;
+		}
+		assert (zeta.contains(u));
+		assert (eta.contains(u));
+		return true;
+	});
+}
+
+template<typename F>
+void ContingencyTable::build(const Partition& zeta, const Partition& eta, count z, F isElement) {
+	const index firstBound = zeta.upperBound();
+	secondBound = eta.upperBound();
+	if (secondBound > 0 && firstBound > std::numeric_limits<index>::max() / secondBound) {
+		throw std::runtime_error("subset id ranges are too large for a contingency table, compact the partitions first");
+	}
+
+	// count the cells of contiguous element blocks in thread-local hash tables
+	std::vector<std::vector<std::pair<index, count>>> localCells(omp_get_max_threads());
+	#pragma omp parallel
+	{
+		const count t = omp_get_thread_num();
+		const count threads = omp_get_num_threads();
+		const index begin = z * t / threads;
+		const index end = z * (t + 1) / threads;
+
+		Aux::HashAccumulator<count> counts;
+		counts.reset(std::min(end - begin, firstBound * secondBound));
+		for (index e = begin; e < end; ++e) {
+			if (isElement(e)) {
+				counts.add(zeta[e] * secondBound + eta[e], 1);
+			}
+		}
+		localCells[t].reserve(counts.size());
+		counts.forEntries([&](index key, count size) {
+			localCells[t].emplace_back(key, size);
+		});
+	}
+
+	// merge cells occurring in several blocks
+	std::vector<index> offset(localCells.size() + 1, 0);
+	for (index t = 0; t < localCells.size(); ++t) {
+		offset[t + 1] = offset[t] + localCells[t].size();
+	}
+	std::vector<std::pair<index, count>> cells(offset.back());
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index t = 0; t < localCells.size(); ++t) {
+		std::copy(localCells[t].begin(), localCells[t].end(), cells.begin() + offset[t]);
+	}
+	localCells.clear();
+	Aux::Parallel::sort(cells.begin(), cells.end());
+
+	cellKey.reserve(cells.size());
+	cellSize.reserve(cells.size());
+	for (const auto& cell : cells) {
+		if (!cellKey.empty() && cellKey.back() == cell.first) {
+			cellSize.back() += cell.second;
+		} else {
+			cellKey.push_back(cell.first);
+			cellSize.push_back(cell.second);
+		}
+	}
+
+	firstSizes.assign(firstBound, 0);
+	secondSizes.assign(secondBound, 0);
+	count sum = 0;
+	#pragma omp parallel for reduction(+:sum)
+	for (index i = 0; i < cellKey.size(); ++i) {
+		#pragma omp atomic
+		firstSizes[cellKey[i] / secondBound] += cellSize[i];
+		#pragma omp atomic
+		secondSizes[cellKey[i] % secondBound] += cellSize[i];
+		sum += cellSize[i];
+	}
+	elements = sum;
+}
+
+index ContingencyTable::cellOf(index C, index D) const {
+	index key = C * secondBound + D;
+	auto it = std::lower_bound(cellKey.begin(), cellKey.end(), key);
+	if (it == cellKey.end() || *it != key) {
+		return none;
+	}
+	return it - cellKey.begin();
+}
+
+namespace {
+
+count pairs(const std::vector<count>& sizes) {
+	count sum = 0;
+	#pragma omp parallel for reduction(+:sum)
+	for (index i = 0; i < sizes.size(); ++i) {
+		sum += sizes[i] * (sizes[i] - 1) / 2;
+	}
+	return sum;
+}
+
+} // namespace
+
+count ContingencyTable::pairsInFirst() const {
+	return pairs(firstSizes);
+}
+
+count ContingencyTable::pairsInSecond() const {
+	return pairs(secondSizes);
+}
+
+count ContingencyTable::pairsInBoth() const {
+	return pairs(cellSize);
+}
+
+} /* namespace NetworKit */
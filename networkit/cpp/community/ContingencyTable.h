@@ -0,0 +1,119 @@
+/*
+ * ContingencyTable.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef CONTINGENCYTABLE_H_
+#define CONTINGENCYTABLE_H_
+
+#include "../structures/Partition.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * The contingency table of two partitions: for every pair of subsets (C, D) of the first and the second partition
+ * the size of their intersection. Only the nonzero cells are stored, so the table needs O(n) space, independent of
+ * the number of subsets. It is built in one parallel pass: every thread counts the cells of a block of elements in
+ * a hash table, and the thread-local cells are merged by a parallel sort. All partition comparison measures based
+ * on overlap sizes (NMIDistance, JaccardMeasure, NodeStructuralRandMeasure, AdjustedRandMeasure and
+ * PartitionIntersection) are computed from it.
+ */
+class ContingencyTable {
+public:
+	/**
+	 * Builds the table for all elements which are assigned in both partitions.
+	 *
+	 * @param zeta The first partition.
+	 * @param eta The second partition.
+	 */
+	ContingencyTable(const Partition& zeta, const Partition& eta);
+
+	/**
+	 * Builds the table for the nodes of @a G. Every node has to be assigned in both partitions.
+	 *
+	 * @param G The graph.
+	 * @param zeta The first partition.
+	 * @param eta The second partition.
+	 */
+	ContingencyTable(const Graph& G, const Partition& zeta, const Partition& eta);
+
+	/**
+	 * @return The number of elements counted in the table.
+	 */
+	count numberOfElements() const {
+		return elements;
+	}
+
+	/**
+	 * @return The number of nonempty cells, i.e. of nonempty intersections.
+	 */
+	count numberOfCells() const {
+		return cellSize.size();
+	}
+
+	/**
+	 * @return The subset sizes of the first partition, indexed by subset id.
+	 */
+	const std::vector<count>& getFirstSizes() const {
+		return firstSizes;
+	}
+
+	/**
+	 * @return The subset sizes of the second partition, indexed by subset id.
+	 */
+	const std::vector<count>& getSecondSizes() const {
+		return secondSizes;
+	}
+
+	/**
+	 * Calls @a handle(C, D, size) for all nonempty cells, ordered by @a C and then by @a D.
+	 */
+	template<typename L> void forCells(L handle) const;
+
+	/**
+	 * Finds the position of a cell in the order of forCells() in O(log numberOfCells()).
+	 *
+	 * @param C A subset of the first partition.
+	 * @param D A subset of the second partition.
+	 * @return The index of the cell (C, D), none if the intersection of @a C and @a D is empty.
+	 */
+	index cellOf(index C, index D) const;
+
+	/**
+	 * @return The number of element pairs that are in the same subset in the first partition.
+	 */
+	count pairsInFirst() const;
+
+	/**
+	 * @return The number of element pairs that are in the same subset in the second partition.
+	 */
+	count pairsInSecond() const;
+
+	/**
+	 * @return The number of element pairs that are in the same subset in both partitions.
+	 */
+	count pairsInBoth() const;
+
+private:
+	index secondBound; // upper bound of the subset ids of the second partition
+	count elements;
+	std::vector<index> cellKey; // C * secondBound + D, sorted
+	std::vector<count> cellSize;
+	std::vector<count> firstSizes;
+	std::vector<count> secondSizes;
+
+	template<typename F> void build(const Partition& zeta, const Partition& eta, count z, F isElement);
+};
+
+template<typename L>
+inline void ContingencyTable::forCells(L handle) const {
+	for (index i = 0; i < cellKey.size(); ++i) {
+		handle(cellKey[i] / secondBound, cellKey[i] % secondBound, cellSize[i]);
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* CONTINGENCYTABLE_H_ */
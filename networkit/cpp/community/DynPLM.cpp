@@ -0,0 +1,249 @@
+/*
+ * DynPLM.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "DynPLM.h"
+#include "PLM.h"
+#include "../auxiliary/Log.h"
+#include "../auxiliary/SignalHandling.h"
+
+#include <algorithm>
+#include <sstream>
+#include <omp.h>
+
+namespace NetworKit {
+
+DynPLM::DynPLM(const Graph& G, double gamma, std::string par, count maxIter) : CommunityDetectionAlgorithm(G), gamma(gamma), parallelism(par), maxIter(maxIter), total(0) {
+}
+
+DynPLM::DynPLM(const Graph& G, const Partition& previous, double gamma, std::string par, count maxIter) : CommunityDetectionAlgorithm(G, previous), gamma(gamma), parallelism(par), maxIter(maxIter), total(0) {
+	if (previous.numberOfElements() < G.upperNodeIdBound()) {
+		throw std::runtime_error("partition does not cover all nodes of the graph");
+	}
+	initVolumes();
+	hasRun = true;
+}
+
+void DynPLM::run() {
+	PLM plm(G, false, gamma, parallelism, maxIter, false, true, true);
+	plm.run();
+	result = plm.getPartition();
+	initVolumes();
+	hasRun = true;
+}
+
+void DynPLM::initVolumes() {
+	const count z = std::max(G.upperNodeIdBound(), result.numberOfElements());
+	volNode.assign(z, 0.0);
+	G.parallelForNodes([&](node u) {
+		volNode[u] = G.weightedDegree(u) + G.weight(u, u); // consider self-loop twice
+	});
+	total = G.totalEdgeWeight();
+	// the previous partition may use ids beyond its upper bound, new singletons must not collide with them
+	index bound = result.upperBound();
+	result.forEntries([&](node u, index C) {
+		if (C != none) {
+			bound = std::max(bound, C + 1);
+		}
+	});
+	result.setUpperBound(bound);
+	volCommunity.assign(bound, 0.0);
+	result.parallelForEntries([&](node u, index C) {
+		if (C != none && u < z) {
+			#pragma omp atomic update
+			volCommunity[C] += volNode[u];
+		}
+	});
+	std::vector<std::atomic<bool>>(z).swap(queued);
+	for (auto& q : queued) {
+		q.store(false, std::memory_order_relaxed);
+	}
+}
+
+void DynPLM::update(const std::vector<GraphEvent>& batch) {
+	if (!hasRun) {
+		throw std::runtime_error("Call run()-function first.");
+	}
+
+	const count z = G.upperNodeIdBound();
+	if (volNode.size() < z) {
+		volNode.resize(std::max(z, 2 * volNode.size()), 0.0);
+		std::vector<std::atomic<bool>> grown(volNode.size());
+		for (auto& q : grown) {
+			q.store(false, std::memory_order_relaxed);
+		}
+		queued.swap(grown);
+	}
+	while (result.numberOfElements() < z) {
+		result.extend();
+	}
+
+	// added, restored and removed nodes and the endpoints of changed edges have to be reconsidered
+	std::vector<node> affected;
+	for (const GraphEvent& ev : batch) {
+		switch (ev.type) {
+			case GraphEvent::NODE_ADDITION :
+			case GraphEvent::NODE_RESTORATION :
+			case GraphEvent::NODE_REMOVAL : {
+				affected.push_back(ev.u);
+				break;
+			}
+			case GraphEvent::EDGE_ADDITION :
+			case GraphEvent::EDGE_REMOVAL :
+			case GraphEvent::EDGE_WEIGHT_UPDATE :
+			case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+				affected.push_back(ev.u);
+				affected.push_back(ev.v);
+				break;
+			}
+			default: {
+				break;
+			}
+		}
+	}
+	std::sort(affected.begin(), affected.end());
+	affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+
+	// new and restored nodes start as singletons, whose ids lie beyond the community volumes
+	for (node u : affected) {
+		if (u < z && G.hasNode(u) && result[u] == none) {
+			result.toSingleton(u);
+		}
+	}
+	if (volCommunity.size() < result.upperBound()) {
+		volCommunity.resize(std::max(result.upperBound(), 2 * volCommunity.size()), 0.0);
+	}
+
+	// bring the volumes of the affected nodes up to date, their difference also changes the total weight,
+	// and removed nodes leave the partition
+	for (node u : affected) {
+		if (u >= z) {
+			continue;
+		}
+		double vol = G.hasNode(u) ? G.weightedDegree(u) + G.weight(u, u) : 0.0;
+		double diff = vol - volNode[u];
+		if (result[u] != none) {
+			volCommunity[result[u]] += diff;
+		}
+		total += diff / 2;
+		volNode[u] = vol;
+		if (!G.hasNode(u)) {
+			result.remove(u);
+		}
+	}
+	affected.erase(std::remove_if(affected.begin(), affected.end(), [&](node u) {
+		return u >= z || !G.hasNode(u);
+	}), affected.end());
+
+	moveNodes(std::move(affected));
+
+	// every new singleton takes a new subset id, so compact once the ids are sparse
+	if (result.upperBound() > 2 * z) {
+		result.compact();
+		volCommunity.assign(result.upperBound(), 0.0);
+		result.forEntries([&](node u, index C) {
+			if (C != none) {
+				volCommunity[C] += volNode[u];
+			}
+		});
+	}
+}
+
+void DynPLM::moveNodes(std::vector<node> active) {
+	if (total <= 0) {
+		return;
+	}
+	Aux::SignalHandler handler;
+	const edgeweight divisor = 2 * total * total; // needed in modularity calculation
+	const bool parallel = parallelism != "none" && parallelism != "none randomized";
+	const count threads = parallel ? omp_get_max_threads() : 1;
+	if (affinity.size() < threads) {
+		affinity.resize(threads);
+	}
+	std::vector<std::vector<node>> localActive(threads);
+
+	// try to improve modularity by moving u to a neighboring community, returns true if it moved
+	auto tryMove = [&](node u) {
+		Aux::HashAccumulator<edgeweight>& aff = affinity[omp_get_thread_num()];
+		const index C = result[u];
+		aff.reset(G.degree(u) + 1);
+		aff.add(C, 0);
+		G.forNeighborsOf(u, [&](node v, edgeweight weight) {
+			if (u != v) {
+				aff.add(result[v], weight);
+			}
+		});
+
+		// $\vol(C \ {u})$ - volume of community D excluding node u
+		const double volN = volNode[u];
+		auto volCommunityMinusNode = [&](index D) {
+			return D == C ? volCommunity[D] - volN : volCommunity[D];
+		};
+		const edgeweight affinityC = aff.get(C);
+		index best = none;
+		double deltaBest = 0;
+		aff.forEntries([&](index D, edgeweight affinityD) {
+			if (D != C) {
+				double delta = (affinityD - affinityC) / total + gamma * ((volCommunityMinusNode(C) - volCommunityMinusNode(D)) * volN) / divisor;
+				if (delta > deltaBest) {
+					deltaBest = delta;
+					best = D;
+				}
+			}
+		});
+		if (best == none) {
+			return false;
+		}
+		result[u] = best;
+		#pragma omp atomic update
+		volCommunity[C] -= volN;
+		#pragma omp atomic update
+		volCommunity[best] += volN;
+		return true;
+	};
+
+	count iter = 0;
+	while (!active.empty() && iter < maxIter && handler.isRunning()) {
+		#pragma omp parallel for if(parallel)
+		for (index i = 0; i < active.size(); ++i) {
+			queued[active[i]] = false;
+		}
+		#pragma omp parallel if(parallel)
+		{
+			std::vector<node>& next = localActive[omp_get_thread_num()];
+			next.clear();
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < active.size(); ++i) {
+				node u = active[i];
+				if (tryMove(u)) {
+					G.forNeighborsOf(u, [&](node v) {
+						if (!queued[v].exchange(true)) {
+							next.push_back(v);
+						}
+					});
+				}
+			}
+		}
+
+		active.clear();
+		for (auto& next : localActive) {
+			active.insert(active.end(), next.begin(), next.end());
+		}
+		iter += 1;
+	}
+	// nodes still queued when the iteration limit is reached must not stay marked for the next update
+	for (node u : active) {
+		queued[u] = false;
+	}
+	DEBUG("iterations in move phase: ", iter);
+}
+
+std::string DynPLM::toString() const {
+	std::stringstream stream;
+	stream << "DynPLM(" << parallelism << ")";
+	return stream.str();
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,94 @@
+/*
+ * DynPLM.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef DYNPLM_H_
+#define DYNPLM_H_
+
+#include "CommunityDetectionAlgorithm.h"
+#include "../dynamics/GraphEvent.h"
+#include "../auxiliary/HashAccumulator.h"
+
+#include <atomic>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Dynamic community detection with the move phase of PLM. After the graph has changed, the communities are
+ * not recomputed from scratch: starting from the previous partition, in which new and restored nodes are
+ * singletons, only the endpoints of changed edges and new nodes are visited by the local moving of PLM, and
+ * the neighbors of every node that moves are visited next. The node volumes, the community volumes and the
+ * total edge weight are kept between updates and only changed for the affected nodes.
+ */
+class DynPLM: public NetworKit::CommunityDetectionAlgorithm {
+
+public:
+	/**
+	 * @param[in]	G	input graph
+	 * @param[in]	gamma	multi-resolution modularity parameter, see PLM
+	 * @param[in]	par		parallelization strategy, see PLM
+	 * @param[in]	maxIter		maximum number of iterations for move phase
+	 */
+	DynPLM(const Graph& G, double gamma = 1.0, std::string par = "balanced", count maxIter = 32);
+
+	/**
+	 * Starts from a known partition of @a G, update() can be called without run().
+	 *
+	 * @param[in]	G	input graph
+	 * @param[in]	previous	partition of @a G
+	 * @param[in]	gamma	multi-resolution modularity parameter, see PLM
+	 * @param[in]	par		parallelization strategy, see PLM
+	 * @param[in]	maxIter		maximum number of iterations for move phase
+	 */
+	DynPLM(const Graph& G, const Partition& previous, double gamma = 1.0, std::string par = "balanced", count maxIter = 32);
+
+	/**
+	 * Detects the communities of the current graph from scratch with PLM.
+	 */
+	void run() override;
+
+	/**
+	 * Updates the communities after the graph has been changed by the events of @a batch
+	 * (e.g. with GraphUpdater). The cost depends on the changed part of the graph only: it is linear in the
+	 * size of @a batch and in the degrees of the nodes visited by the move phase. Growing the arrays for new nodes
+	 * and compacting the community ids once they get sparse cost O(n) but happen only after O(n) new nodes.
+	 *
+	 * @param batch The events that have been applied to the graph.
+	 */
+	void update(const std::vector<GraphEvent>& batch);
+
+	/**
+	 * Get string representation.
+	 *
+	 * @return String representation of this algorithm.
+	 */
+	std::string toString() const override;
+
+private:
+	double gamma;
+	std::string parallelism;
+	count maxIter;
+
+	std::vector<double> volNode; //!< weighted degree of every node, self-loops count twice
+	std::vector<double> volCommunity; //!< sum of the node volumes of every community
+	edgeweight total; //!< total edge weight of the graph
+	std::vector<std::atomic<bool>> queued; //!< whether a node is in the next worklist of the move phase
+	std::vector<Aux::HashAccumulator<edgeweight>> affinity; //!< edge weight to the neighboring communities, one per thread
+
+	/**
+	 * Computes the volumes from scratch for the current graph and partition.
+	 */
+	void initVolumes();
+
+	/**
+	 * Local moving starting from the nodes in @a active, the neighbors of moved nodes are visited next.
+	 */
+	void moveNodes(std::vector<node> active);
+};
+
+} /* namespace NetworKit */
+
+#endif /* DYNPLM_H_ */
@@ -0,0 +1,181 @@
+/*
+ * IncrementalQuality.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "IncrementalQuality.h"
+#include "../auxiliary/Log.h"
+
+#include <stdexcept>
+
+namespace NetworKit {
+
+IncrementalQuality::IncrementalQuality(Graph& G, const Partition& zeta) : G(G), zeta(zeta), totalWeight(0.0), intraWeight(0.0), volume(zeta.upperBound(), 0.0), sumOfSquaredVolumes(0.0) {
+	if (zeta.numberOfElements() < G.upperNodeIdBound()) {
+		throw std::runtime_error("partition does not cover all nodes of the graph");
+	}
+
+	edgeweight total = 0.0;
+	edgeweight intra = 0.0;
+	G.parallelForEdges([&](node u, node v, edgeweight w) {
+		#pragma omp atomic
+		total += w;
+		if (zeta[u] == zeta[v]) {
+			#pragma omp atomic
+			intra += w;
+		}
+	});
+	totalWeight = total;
+	intraWeight = intra;
+
+	G.parallelForNodes([&](node u) {
+		double volU = nodeVolume(u);
+		#pragma omp atomic
+		volume[zeta[u]] += volU;
+	});
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (index C = 0; C < volume.size(); ++C) {
+		sum += volume[C] * volume[C];
+	}
+	sumOfSquaredVolumes = sum;
+}
+
+double IncrementalQuality::nodeVolume(node u) const {
+	return G.weightedDegree(u) + G.weight(u, u); // account for self-loops a second time
+}
+
+void IncrementalQuality::addToVolume(index C, double delta) {
+	if (C >= volume.size()) {
+		volume.resize(C + 1, 0.0);
+	}
+	sumOfSquaredVolumes += delta * (2 * volume[C] + delta);
+	volume[C] += delta;
+}
+
+void IncrementalQuality::setSubset(node u, index C) {
+	index D = zeta[u];
+	if (C == D) {
+		return;
+	}
+	// edges to the old subset are cut afterwards, edges to the new one become internal; self-loops stay internal
+	G.forNeighborsOf(u, [&](node v, edgeweight w) {
+		if (v != u) {
+			if (zeta[v] == D) {
+				intraWeight -= w;
+			} else if (zeta[v] == C) {
+				intraWeight += w;
+			}
+		}
+	});
+	double volU = nodeVolume(u);
+	addToVolume(D, -volU);
+	addToVolume(C, volU);
+	zeta[u] = C;
+}
+
+void IncrementalQuality::moveToSubset(node u, index C) {
+	if (C >= zeta.upperBound()) {
+		throw std::runtime_error("subset id out of range, use toSingleton to create a new subset");
+	}
+	setSubset(u, C);
+}
+
+void IncrementalQuality::toSingleton(node u) {
+	index C = zeta.upperBound();
+	zeta.setUpperBound(C + 1);
+	setSubset(u, C);
+}
+
+void IncrementalQuality::changeEdgeWeight(node u, node v, edgeweight delta) {
+	totalWeight += delta;
+	if (zeta[u] == zeta[v]) {
+		intraWeight += delta;
+	}
+	addToVolume(zeta[u], delta);
+	addToVolume(zeta[v], delta);
+}
+
+void IncrementalQuality::update(const std::vector<GraphEvent>& batch) {
+	for (GraphEvent ev : batch) {
+		TRACE("event: " , ev.toString());
+		switch (ev.type) {
+			case GraphEvent::NODE_ADDITION : {
+				node u = G.addNode();
+				while (zeta.numberOfElements() <= u) {
+					zeta.extend();
+				}
+				zeta.toSingleton(u);
+				break;
+			}
+			case GraphEvent::NODE_REMOVAL : {
+				G.removeNode(ev.u); // the node is isolated, so its volume is 0
+				zeta.remove(ev.u);
+				break;
+			}
+			case GraphEvent::NODE_RESTORATION : {
+				G.restoreNode(ev.u);
+				zeta.toSingleton(ev.u);
+				break;
+			}
+			case GraphEvent::EDGE_ADDITION : {
+				G.addEdge(ev.u, ev.v, ev.w);
+				changeEdgeWeight(ev.u, ev.v, ev.w);
+				break;
+			}
+			case GraphEvent::EDGE_REMOVAL : {
+				edgeweight w = G.weight(ev.u, ev.v);
+				G.removeEdge(ev.u, ev.v);
+				changeEdgeWeight(ev.u, ev.v, -w);
+				break;
+			}
+			case GraphEvent::EDGE_WEIGHT_UPDATE : {
+				edgeweight w = G.weight(ev.u, ev.v);
+				G.setWeight(ev.u, ev.v, ev.w);
+				changeEdgeWeight(ev.u, ev.v, ev.w - w);
+				break;
+			}
+			case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+				G.setWeight(ev.u, ev.v, G.weight(ev.u, ev.v) + ev.w);
+				changeEdgeWeight(ev.u, ev.v, ev.w);
+				break;
+			}
+			case GraphEvent::TIME_STEP : {
+				G.timeStep();
+				break;
+			}
+			default: {
+				throw std::runtime_error("unknown event type");
+			}
+		}
+	}
+}
+
+double IncrementalQuality::getModularity() const {
+	if (totalWeight == 0.0) {
+		throw std::invalid_argument("Modularity is undefined for graphs without edges (including self-loops).");
+	}
+	return intraWeight / totalWeight - sumOfSquaredVolumes / (4 * totalWeight * totalWeight);
+}
+
+double IncrementalQuality::getCoverage() const {
+	if (totalWeight == 0.0) {
+		throw std::invalid_argument("Coverage is undefined for graphs without edges (including self-loops).");
+	}
+	return intraWeight / totalWeight;
+}
+
+double IncrementalQuality::getCut() const {
+	return totalWeight - intraWeight;
+}
+
+double IncrementalQuality::getVolume(index C) const {
+	return C < volume.size() ? volume[C] : 0.0;
+}
+
+const Partition& IncrementalQuality::getPartition() const {
+	return zeta;
+}
+
+} /* namespace NetworKit */
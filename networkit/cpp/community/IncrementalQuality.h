@@ -0,0 +1,98 @@
+/*
+ * IncrementalQuality.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef INCREMENTALQUALITY_H_
+#define INCREMENTALQUALITY_H_
+
+#include "../graph/Graph.h"
+#include "../structures/Partition.h"
+#include "../dynamics/GraphEvent.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Keeps modularity, coverage and edge cut of a partition up to date while nodes are moved between subsets
+ * and while the graph changes. Instead of the O(m) evaluation of Modularity, Coverage and EdgeCut, every
+ * change costs O(degree) of the affected nodes: the tracker only maintains the total and intra-cluster edge
+ * weight and the volume of every cluster.
+ *
+ * Graph changes have to be passed as GraphEvent batches to update(), which applies them to the graph like
+ * GraphUpdater (the old weights of removed and updated edges are needed).
+ */
+class IncrementalQuality {
+public:
+	/**
+	 * Computes the initial values in O(m).
+	 *
+	 * @param G The graph, which is modified by update().
+	 * @param zeta The partition, it is copied and maintained by the tracker.
+	 */
+	IncrementalQuality(Graph& G, const Partition& zeta);
+
+	/**
+	 * Moves node @a u to subset @a C.
+	 *
+	 * @param u The node.
+	 * @param C An existing subset id, i.e. less than the upper bound of the partition.
+	 */
+	void moveToSubset(node u, index C);
+
+	/**
+	 * Moves node @a u to a new singleton subset.
+	 */
+	void toSingleton(node u);
+
+	/**
+	 * Applies the events to the graph and updates the quality values. Added or restored nodes become
+	 * singletons, removed nodes are removed from the partition.
+	 *
+	 * @param batch The graph events.
+	 */
+	void update(const std::vector<GraphEvent>& batch);
+
+	/**
+	 * @return The modularity of the partition, see Modularity.
+	 */
+	double getModularity() const;
+
+	/**
+	 * @return The coverage of the partition, see Coverage.
+	 */
+	double getCoverage() const;
+
+	/**
+	 * @return The weight of the edges between subsets, see EdgeCut.
+	 */
+	double getCut() const;
+
+	/**
+	 * @return The volume (sum of weighted degrees, self-loops count twice) of subset @a C.
+	 */
+	double getVolume(index C) const;
+
+	/**
+	 * @return The current partition.
+	 */
+	const Partition& getPartition() const;
+
+private:
+	Graph& G;
+	Partition zeta;
+	edgeweight totalWeight; // sum of all edge weights
+	edgeweight intraWeight; // sum of the weights of edges inside subsets
+	std::vector<double> volume; // volume of every subset
+	double sumOfSquaredVolumes;
+
+	void addToVolume(index C, double delta);
+	void changeEdgeWeight(node u, node v, edgeweight delta);
+	double nodeVolume(node u) const;
+	void setSubset(node u, index C);
+};
+
+} /* namespace NetworKit */
+
+#endif /* INCREMENTALQUALITY_H_ */
@@ -11,7 +11,7 @@
 #include "../auxiliary/MissingMath.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/Log.h"
-#include "PartitionIntersection.h"
+#include "ContingencyTable.h"
 
 namespace NetworKit {
 
@@ -24,18 +24,9 @@ double NMIDistance::getDissimilarity(const Graph& G, const Partition& zeta, cons
 	DEBUG("eta=" , eta.getVector());
 
 
-	std::vector<count> size_zeta(zeta.upperBound(), 0), size_eta(eta.upperBound(), 0);
-
-	// precompute sizes for each cluster
-
-	G.forNodes([&](node u){
-		index C = zeta[u];
-		index D = eta[u];
-		assert (C != none);
-		assert (D != none);
-		size_zeta[C] += 1;
-		size_eta[D] += 1;
-	});
+	ContingencyTable table(G, zeta, eta);
+	const std::vector<count>& size_zeta = table.getFirstSizes();
+	const std::vector<count>& size_eta = table.getSecondSizes();
 
 	DEBUG("size_zeta=" , size_zeta);
 	DEBUG("size_eta=" , size_eta);
@@ -52,49 +43,25 @@ double NMIDistance::getDissimilarity(const Graph& G, const Partition& zeta, cons
 		P_eta[D] = size_eta[D] / (double) n;
 	}
 
-	Partition overlap = PartitionIntersection().calculate(zeta, eta);
-	DEBUG("overlap=", overlap.getVector());
-
-	std::vector<index> overlap_zeta(overlap.upperBound(), none), overlap_eta(overlap.upperBound(), none); // map from the overlap to zeta and eta
-
-	std::vector<count> overlapSizes(overlap.upperBound(), 0); // overlapSizes[O] returns the size of the overlap cluster
-
-	G.forNodes([&](node u){
-		index O = overlap[u];
-		if (overlapSizes[O] == 0) {
-			overlap_zeta[O] = zeta[u];
-			overlap_eta[O] = eta[u];
-		}
-		overlapSizes[O] += 1;
-	});
-
-	DEBUG("overlapSizes=", overlapSizes);
-
-
 	auto log_b = Aux::MissingMath::log_b; // import convenient logarithm function
 
 
 	// calculate mutual information
 	//		 $MI(\zeta,\eta):=\sum_{C\in\zeta}\sum_{D\in\eta}\frac{|C\cap D|}{n}\cdot\log_{2}\left(\frac{|C\cap D|\cdot n}{|C|\cdot|D|}\right)$
 	double MI = 0.0; // mutual information
-	for (index O = 0; O < overlapSizes.size(); ++O) {
-		if (overlapSizes[O] > 0) {
-			index C = overlap_zeta[O];
-			index D = overlap_eta[O];
-			count sizeC = size_zeta[C];
-			count sizeD = size_eta[D];
-			count sizeO = overlapSizes[O];
-			double factor1 =  sizeO / (double) n;
-			assert ((sizeC * sizeD) != 0);
-			TRACE("overlap of " , C , " and " , D , " has size: " , sizeO);
-			TRACE("union of " , C , " and " , D , " has size: " , (sizeD + sizeC - sizeO));
-			double frac2 = (sizeO * n) / (double) (sizeC * sizeD);
-			assert (frac2 != 0);
-			double factor2 = log_b(frac2, 2);
-			TRACE("frac2 = " , frac2 , ", factor1 = " , factor1 , ", factor2 = " , factor2);
-			MI += factor1 * factor2;
-		}
-	}
+	table.forCells([&](index C, index D, count sizeO) {
+		count sizeC = size_zeta[C];
+		count sizeD = size_eta[D];
+		double factor1 =  sizeO / (double) n;
+		assert ((sizeC * sizeD) != 0);
+		TRACE("overlap of " , C , " and " , D , " has size: " , sizeO);
+		TRACE("union of " , C , " and " , D , " has size: " , (sizeD + sizeC - sizeO));
+		double frac2 = (sizeO * n) / ((double) sizeC * sizeD);
+		assert (frac2 != 0);
+		double factor2 = log_b(frac2, 2);
+		TRACE("frac2 = " , frac2 , ", factor1 = " , factor1 , ", factor2 = " , factor2);
+		MI += factor1 * factor2;
+	});
 
 	// sanity check
 	assert (! std::isnan(MI));
@@ -12,17 +12,19 @@
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/SignalHandling.h"
+#include "../auxiliary/HashAccumulator.h"
+#include "../structures/ConcurrentUnionFind.h"
 
 
 #include <sstream>
 
 namespace NetworKit {
 
-PLM::PLM(const Graph& G, bool refine, double gamma, std::string par, count maxIter, bool turbo, bool recurse) : CommunityDetectionAlgorithm(G), parallelism(par), refine(refine), gamma(gamma), maxIter(maxIter), turbo(turbo), recurse(recurse) {
+PLM::PLM(const Graph& G, bool refine, double gamma, std::string par, count maxIter, bool turbo, bool recurse, bool hashAffinity, bool leiden) : CommunityDetectionAlgorithm(G), parallelism(par), refine(refine), gamma(gamma), maxIter(maxIter), turbo(turbo), recurse(recurse), hashAffinity(hashAffinity), leiden(leiden) {
 
 }
 
-PLM::PLM(const Graph& G, const PLM& other) : CommunityDetectionAlgorithm(G), parallelism(other.parallelism), refine(other.refine), gamma(other.gamma), maxIter(other.maxIter), turbo(other.turbo), recurse(other.recurse) {
+PLM::PLM(const Graph& G, const PLM& other) : CommunityDetectionAlgorithm(G), parallelism(other.parallelism), refine(other.refine), gamma(other.gamma), maxIter(other.maxIter), turbo(other.turbo), recurse(other.recurse), hashAffinity(other.hashAffinity), leiden(other.leiden) {
 
 }
 
@@ -33,9 +35,13 @@ void PLM::run() {
 	count z = G.upperNodeIdBound();
 
 
-	// init communities to singletons
+	// init communities to singletons, or to the communities of the finer level in Leiden mode
 	Partition zeta(z);
-	zeta.allToSingletons();
+	if (initialPartition.numberOfElements() == z) {
+		zeta = initialPartition;
+	} else {
+		zeta.allToSingletons();
+	}
 	index o = zeta.upperBound();
 
 	// init graph-dependent temporaries
@@ -54,8 +60,11 @@ void PLM::run() {
 	// init community-dependent temporaries
 	std::vector<double> volCommunity(o, 0.0);
 	zeta.parallelForEntries([&](node u, index C) { 	// set volume for all communities
-		if (C != none)
-			volCommunity[C] = volNode[u];
+		if (C != none) {
+			edgeweight volN = volNode[u];
+			#pragma omp atomic update
+			volCommunity[C] += volN;
+		}
 	});
 
 	// first move phase
@@ -66,7 +75,8 @@ void PLM::run() {
 	std::vector<std::vector<edgeweight> > turboAffinity;
 	// stores the list of neighboring communities, one vector per thread
 	std::vector<std::vector<index> > neigh_comm;
-
+	// stores the affinity for each neighboring community in a hash table, one per thread
+	std::vector<Aux::HashAccumulator<edgeweight> > hashedAffinity;
 
 	if (turbo) {
 		if (this->parallelism != "none" && this->parallelism != "none randomized") { // initialize arrays for all threads only when actually needed
@@ -84,6 +94,9 @@ void PLM::run() {
 			turboAffinity.emplace_back(zeta.upperBound());
 			neigh_comm.emplace_back(G.upperNodeIdBound());
 		}
+	} else if (hashAffinity) {
+		// the tables grow on demand up to the maximum degree
+		hashedAffinity.resize(omp_get_max_threads());
 	}
 
 	// try to improve modularity by moving a node to neighboring clusters
@@ -112,6 +125,14 @@ void PLM::run() {
 					turboAffinity[tid][C] += weight;
 				}
 			});
+		} else if (hashAffinity) {
+			hashedAffinity[tid].reset(G.degree(u) + 1);
+			hashedAffinity[tid].add(zeta[u], 0);
+			G.forNeighborsOf(u, [&](node v, edgeweight weight) {
+				if (u != v) {
+					hashedAffinity[tid].add(zeta[v], weight);
+				}
+			});
 		} else {
 			G.forNeighborsOf(u, [&](node v, edgeweight weight) {
 				if (u != v) {
@@ -173,6 +194,18 @@ void PLM::run() {
 					}
 				}
 			}
+		} else if (hashAffinity) {
+			edgeweight affinityC = hashedAffinity[tid].get(C);
+
+			hashedAffinity[tid].forEntries([&](index D, edgeweight affinityD) {
+				if (D != C) { // consider only nodes in other clusters (and implicitly only nodes other than u)
+					double delta = modGain(u, C, D, affinityC, affinityD);
+					if (delta > deltaBest) {
+						deltaBest = delta;
+						best = D;
+					}
+				}
+			});
 		} else {
 			edgeweight affinityC = affinity[C];
 
@@ -250,17 +283,39 @@ void PLM::run() {
 	timer.stop();
 	timing["move"].push_back(timer.elapsedMilliseconds());
 	handler.assureRunning();
-	if (recurse && change) {
+	bool aggregate = recurse && change;
+	Partition refined;
+	if (recurse && leiden) {
+		timer.start();
+		//
+		refined = refineConnected(zeta, volNode, total);
+		//
+		timer.stop();
+		timing["leiden"].push_back(timer.elapsedMilliseconds());
+		// even without moves the subcommunities of the communities from the finer level can be aggregated
+		aggregate = refined.numberOfSubsets() < z;
+	}
+	handler.assureRunning();
+	if (aggregate) {
 		INFO("nodes moved, so begin coarsening and recursive call");
 
 		timer.start();
 		//
-		std::pair<Graph, std::vector<node>> coarsened = coarsen(G, zeta);	// coarsen graph according to communitites
+		std::pair<Graph, std::vector<node>> coarsened = coarsen(G, leiden ? refined : zeta);	// coarsen graph according to communitites
 		//
 		timer.stop();
 		timing["coarsen"].push_back(timer.elapsedMilliseconds());
 
-		PLM onCoarsened(coarsened.first, this->refine, this->gamma, this->parallelism, this->maxIter, this->turbo);
+		PLM onCoarsened(coarsened.first, this->refine, this->gamma, this->parallelism, this->maxIter, this->turbo, this->recurse, this->hashAffinity, this->leiden);
+		if (leiden) {
+			// every subcommunity lies in one community, which is where its supernode starts
+			onCoarsened.initialPartition = Partition(coarsened.first.upperNodeIdBound());
+			onCoarsened.initialPartition.setUpperBound(zeta.upperBound());
+			#pragma omp parallel for
+			for (node u = 0; u < z; ++u) {
+				onCoarsened.initialPartition[coarsened.second[u]] = zeta[u];
+			}
+		}
 		onCoarsened.run();
 		Partition zetaCoarse = onCoarsened.getPartition();
 
@@ -275,6 +330,9 @@ void PLM::run() {
 		for (count t : tim["refine"]) {
 			timing["refine"].push_back(t);
 		}
+		for (count t : tim["leiden"]) {
+			timing["leiden"].push_back(t);
+		}
 
 
 		INFO("coarse graph has ", coarsened.first.numberOfNodes(), " nodes and ", coarsened.first.numberOfEdges(), " edges");
@@ -303,6 +361,16 @@ void PLM::run() {
 
 		}
 	}
+	if (leiden) {
+		// moves on the last level can still disconnect a community, splitting it never decreases modularity
+		ConcurrentUnionFind parts(z);
+		G.parallelForEdges([&](node u, node v) {
+			if (zeta[u] == zeta[v]) {
+				parts.merge(u, v);
+			}
+		});
+		zeta = parts.toPartition();
+	}
 	result = std::move(zeta);
 	hasRun = true;
 }
@@ -317,15 +385,107 @@ std::string NetworKit::PLM::toString() const {
 	stream << "," << "pc";
 	if (turbo) {
 		stream << "," << "turbo";
+	} else if (hashAffinity) {
+		stream << "," << "hash";
 	}
 	if (!recurse) {
 		stream << "," << "non-recursive";
+	} else if (leiden) {
+		stream << "," << "leiden";
 	}
 	stream << ")";
 
 	return stream.str();
 }
 
+Partition PLM::refineConnected(const Partition& zeta, const std::vector<double>& volNode, edgeweight total) const {
+	count z = G.upperNodeIdBound();
+	Partition refined(z);
+	refined.allToSingletons();
+
+	// group the nodes by community
+	index o = zeta.upperBound();
+	std::vector<index> begin(o + 1, 0);
+	G.forNodes([&](node u) {
+		++begin[zeta[u] + 1];
+	});
+	for (index C = 0; C < o; ++C) {
+		begin[C + 1] += begin[C];
+	}
+	std::vector<node> members(begin[o]);
+	std::vector<index> next(begin.begin(), begin.end() - 1);
+	G.forNodes([&](node u) {
+		members[next[zeta[u]]++] = u;
+	});
+
+	// per subcommunity (indexed by its id): volume, size and weight of the edges to the rest of its community
+	std::vector<double> volRefined(volNode);
+	std::vector<count> size(z, 1);
+	std::vector<edgeweight> cut(z, 0.0);
+	std::vector<Aux::HashAccumulator<edgeweight> > affinity(omp_get_max_threads());
+
+	#pragma omp parallel for schedule(dynamic, 16)
+	for (index C = 0; C < o; ++C) {
+		if (begin[C + 1] - begin[C] < 2) {
+			continue;
+		}
+		index tid = omp_get_thread_num();
+		double volC = 0.0;
+		for (index i = begin[C]; i < begin[C + 1]; ++i) {
+			node u = members[i];
+			volC += volNode[u];
+			G.forNeighborsOf(u, [&](node v, edgeweight weight) {
+				if (u != v && zeta[v] == C) {
+					cut[u] += weight;
+				}
+			});
+		}
+		// a set S is well connected if its edges to C \ S are not less than expected for the given resolution
+		auto wellConnected = [&](edgeweight cutS, double volS) {
+			return cutS >= this->gamma * volS * (volC - volS) / (2 * total);
+		};
+
+		for (index i = begin[C]; i < begin[C + 1]; ++i) {
+			node u = members[i];
+			if (size[refined[u]] > 1 || !wellConnected(cut[u], volNode[u])) {
+				continue; // only well-connected singletons are moved
+			}
+			affinity[tid].reset(G.degree(u));
+			G.forNeighborsOf(u, [&](node v, edgeweight weight) {
+				if (u != v && zeta[v] == C) {
+					affinity[tid].add(refined[v], weight);
+				}
+			});
+
+			index best = none;
+			double deltaBest = 0;
+			edgeweight affinityBest = 0;
+			affinity[tid].forEntries([&](index D, edgeweight affinityD) {
+				if (wellConnected(cut[D], volRefined[D])) {
+					// modularity gain of moving u from its singleton to D
+					double delta = affinityD / total - this->gamma * volRefined[D] * volNode[u] / (2 * total * total);
+					if (delta > deltaBest) {
+						deltaBest = delta;
+						best = D;
+						affinityBest = affinityD;
+					}
+				}
+			});
+
+			if (best != none) {
+				index own = refined[u];
+				refined[u] = best;
+				volRefined[best] += volNode[u];
+				size[best] += 1;
+				size[own] = 0;
+				cut[best] += cut[u] - 2 * affinityBest;
+			}
+		}
+	}
+
+	return refined;
+}
+
 std::pair<Graph, std::vector<node> > PLM::coarsen(const Graph& G, const Partition& zeta) {
 	ParallelPartitionCoarsening parCoarsening(G, zeta);
 	parCoarsening.run();
@@ -31,9 +31,14 @@ public:
 	 * @param[in]	parallelCoarsening	use parallel graph coarsening
 	 * @param[in]	turbo	faster but uses O(n) additional memory per thread
 	 * @param[in]	recurse	use recursive coarsening, see http://journals.aps.org/pre/abstract/10.1103/PhysRevE.89.049902 for some explanations (default: true)
+	 * @param[in]	hashAffinity	collect the neighboring communities in a reused hash table per thread, almost as fast as turbo
+	 * 							but the additional memory is bounded by the maximum degree (ignored if turbo is set)
+	 * @param[in]	leiden	Leiden-style refinement: coarsen by connected subcommunities of the move phase communities and
+	 * 							start the next level from the move phase communities, see Traag et al., "From Louvain to
+	 * 							Leiden: guaranteeing well-connected communities" (requires recurse)
 	 *
 	 */
-	PLM(const Graph& G, bool refine=false, double gamma = 1.0, std::string par="balanced", count maxIter=32, bool turbo = false, bool recurse = true);
+	PLM(const Graph& G, bool refine=false, double gamma = 1.0, std::string par="balanced", count maxIter=32, bool turbo = false, bool recurse = true, bool hashAffinity = false, bool leiden = false);
 
 	PLM(const Graph& G, const PLM& other);
 
@@ -61,12 +66,22 @@ public:
 
 private:
 
+	/**
+	 * Splits every community of @a zeta into well-connected subcommunities: starting from singletons, well-connected
+	 * singleton nodes greedily join the well-connected subcommunity of their community with the best modularity gain.
+	 * Communities are processed in parallel. The subcommunities are connected and have the id of their first node.
+	 */
+	Partition refineConnected(const Partition& zeta, const std::vector<double>& volNode, edgeweight total) const;
+
 	std::string parallelism;
 	bool refine;
 	double gamma = 1.0;
 	count maxIter;
 	bool turbo;
 	bool recurse;
+	bool hashAffinity;
+	bool leiden;
+	Partition initialPartition; // communities to start the move phase from on coarse graphs in Leiden mode
 	std::map<std::string, std::vector<count> > timing;	 // fine-grained running time measurement
 };
 
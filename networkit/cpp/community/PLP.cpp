@@ -12,6 +12,9 @@
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/Random.h"
+#include "../auxiliary/HashAccumulator.h"
+
+#include <atomic>
 
 namespace NetworKit {
 
@@ -60,6 +63,12 @@ void PLP::run() {
 	 * In general this does not work. It was changed to: No label was changed in last iteration.
 	 */
 
+	if (worklist) {
+		runWorklist();
+		hasRun = true;
+		return;
+	}
+
 	std::vector<bool> activeNodes(z); // record if node must be processed
 	activeNodes.assign(z, true);
 
@@ -117,6 +126,95 @@ void PLP::run() {
 	hasRun = true;
 }
 
+void PLP::runWorklist() {
+	typedef index label; // a label is the same as a cluster id
+
+	index z = G.upperNodeIdBound();
+	// isolated nodes stay singletons and never enter the worklist
+	std::vector<node> active;
+	active.reserve(G.numberOfNodes());
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			active.push_back(v);
+		}
+	});
+	std::vector<std::atomic<bool>> queued(z); // whether a node is in the next worklist
+	std::vector<std::vector<node>> localActive(omp_get_max_threads());
+	std::vector<Aux::HashAccumulator<edgeweight>> labelWeights(omp_get_max_threads());
+
+	count nUpdated = active.size();
+	Aux::Timer runtime;
+
+	while (!active.empty() && (nUpdated > this->updateThreshold) && (nIterations < maxIterations)) {
+		runtime.start();
+		nIterations += 1;
+		INFO("[BEGIN] LabelPropagation: iteration #" , nIterations, " on ", active.size(), " active nodes");
+
+		nUpdated = 0;
+
+		// changes of neighbors from now on need another look at the active nodes
+		#pragma omp parallel for
+		for (index i = 0; i < active.size(); ++i) {
+			queued[active[i]] = false;
+		}
+
+		#pragma omp parallel reduction(+:nUpdated)
+		{
+			index tid = omp_get_thread_num();
+			Aux::HashAccumulator<edgeweight>& weights = labelWeights[tid];
+			std::vector<node>& next = localActive[tid];
+			next.clear();
+
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < active.size(); ++i) {
+				node v = active[i];
+
+				// weigh the labels in the neighborhood of v
+				weights.reset(G.degree(v));
+				G.forNeighborsOf(v, [&](node w, edgeweight weight) {
+					weights.add(result[w], weight);
+				});
+
+				// get heaviest label, ties go to the smallest label as in the sweep
+				label current = result[v];
+				label heaviest = none;
+				edgeweight heaviestWeight = 0;
+				weights.forEntries([&](label l, edgeweight weight) {
+					if (weight > heaviestWeight || (weight == heaviestWeight && l < heaviest)) {
+						heaviest = l;
+						heaviestWeight = weight;
+					}
+				});
+
+				if (heaviest != current) { // UPDATE
+					result[v] = heaviest;
+					nUpdated += 1;
+					G.forNeighborsOf(v, [&](node u) {
+						if (!queued[u].exchange(true)) {
+							next.push_back(u);
+						}
+					});
+				}
+			}
+		}
+
+		// concatenate the thread-local worklists
+		std::vector<index> offset(localActive.size() + 1, 0);
+		for (index t = 0; t < localActive.size(); ++t) {
+			offset[t + 1] = offset[t] + localActive[t].size();
+		}
+		active.resize(offset.back());
+		#pragma omp parallel for
+		for (index t = 0; t < localActive.size(); ++t) {
+			std::copy(localActive[t].begin(), localActive[t].end(), active.begin() + offset[t]);
+		}
+
+		runtime.stop();
+		this->timing.push_back(runtime.elapsedMilliseconds());
+		DEBUG("[DONE] LabelPropagation: iteration #" , nIterations , " - updated " , nUpdated , " labels, time spent: " , runtime.elapsedTag());
+	}
+}
+
 std::string PLP::toString() const {
 	std::stringstream strm;
 	strm << "PLP";
@@ -129,6 +227,11 @@ void PLP::setUpdateThreshold(count th) {
 }
 
 
+void PLP::setWorklist(bool worklist) {
+	this->worklist = worklist;
+}
+
+
 count PLP::numberOfIterations() {
 	return this->nIterations;
 }
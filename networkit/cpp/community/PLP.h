@@ -31,6 +31,12 @@ protected:
 	count maxIterations;
 	count nIterations = 0; //!< number of iterations in last run
 	std::vector<count> timing;	//!< running times for each iteration
+	bool worklist = false; //!< process only the active nodes from a worklist instead of sweeping over all nodes
+
+	/**
+	 * Worklist variant of the main loop, see setWorklist().
+	 */
+	void runWorklist();
 
 
 public:
@@ -71,6 +77,16 @@ public:
 	*/
 	virtual void setUpdateThreshold(count th);
 
+	/**
+	 * If @a worklist is @c true, every iteration only processes the nodes whose neighborhood changed in the
+	 * previous one, taken from a worklist, instead of sweeping over all nodes. The label weights are collected in
+	 * a hash table per thread that is reused for all nodes, ties are broken in favor of the smallest label. This
+	 * makes the late iterations, in which only few labels change, much cheaper.
+	 *
+	 * @param worklist Use the worklist.
+	 */
+	virtual void setWorklist(bool worklist);
+
 	/**
 	* Get number of iterations in last run.
 	*
@@ -1,15 +1,16 @@
 #include "PartitionIntersection.h"
+#include "ContingencyTable.h"
 
 #include <algorithm>
 
 NetworKit::Partition NetworKit::PartitionIntersection::calculate(const Partition &zeta, const NetworKit::Partition &eta) {
+	ContingencyTable table(zeta, eta);
 	Partition result(std::max(zeta.numberOfElements(), eta.numberOfElements()));
-	result.setUpperBound(zeta.upperBound()*eta.upperBound());
+	result.setUpperBound(table.numberOfCells());
 	zeta.parallelForEntries([&](node u, index s) {
 		if (zeta.contains(u) && eta.contains(u)) {
-			result[u] = s * eta.upperBound() + eta[u];
+			result[u] = table.cellOf(s, eta[u]);
 		}
 	});
-	result.compact();
 	return result;
 }
@@ -7,6 +7,8 @@
 
 #include "CommunityGTest.h"
 
+#include <set>
+
 #include "../PLP.h"
 #include "../PLM.h"
 #include "../ParallelAgglomerativeClusterer.h"
@@ -33,9 +35,16 @@
 #include "../SampledNodeStructuralRandMeasure.h"
 #include "../../community/GraphClusteringTools.h"
 #include "../PartitionIntersection.h"
+#include "../ContingencyTable.h"
+#include "../AdjustedRandMeasure.h"
 #include "../HubDominance.h"
 #include "../IntrapartitionDensity.h"
 #include "../PartitionFragmentation.h"
+#include "../IncrementalQuality.h"
+#include "../DynPLM.h"
+#include "../../dynamics/GraphUpdater.h"
+#include "../../auxiliary/Random.h"
+#include "../../structures/UnionFind.h"
 #include "../../generators/ClusteredRandomGraphGenerator.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 
@@ -149,6 +158,160 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
 
 
 
+TEST_F(CommunityGTest, testLabelPropagationWithWorklist) {
+	ClusteredRandomGraphGenerator graphGen(1000, 100, 1.0, 0.0);
+	Graph G = graphGen.generate();
+	Partition reference = graphGen.getCommunities();
+
+	PLP lp(G);
+	lp.setWorklist(true);
+	lp.run();
+	Partition zeta = lp.getPartition();
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+	EXPECT_TRUE(GraphClusteringTools::equalClusterings(zeta, reference, G));
+
+	METISGraphReader reader;
+	Modularity modularity;
+	Graph H = reader.read("input/PGPgiantcompo.graph");
+
+	PLP sweep(H, 0);
+	sweep.run();
+	PLP lp2(H, 0);
+	lp2.setWorklist(true);
+	lp2.run();
+	Partition zeta2 = lp2.getPartition();
+
+	INFO("iterations: " , lp2.numberOfIterations(), " (sweep: ", sweep.numberOfIterations(), ")");
+	INFO("modularity: " , modularity.getQuality(zeta2, H), " (sweep: ", modularity.getQuality(sweep.getPartition(), H), ")");
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(H, zeta2));
+	EXPECT_GT(modularity.getQuality(zeta2, H), 0.7);
+}
+
+TEST_F(CommunityGTest, testIncrementalQuality) {
+	count n = 200;
+	Graph G(n, true);
+	for (index i = 0; i < 1000; ++i) {
+		node u = Aux::Random::integer(n - 1);
+		node v = Aux::Random::integer(n - 1);
+		if (u != v && !G.hasEdge(u, v)) {
+			G.addEdge(u, v, Aux::Random::real(0.5, 2.0));
+		}
+	}
+	ClusteringGenerator generator;
+	Partition zeta = generator.makeRandomClustering(G, 10);
+	IncrementalQuality tracker(G, zeta);
+
+	auto check = [&]() {
+		const Partition& current = tracker.getPartition();
+		EXPECT_NEAR(Modularity().getQuality(current, G), tracker.getModularity(), 1e-9);
+		EXPECT_NEAR(Coverage().getQuality(current, G), tracker.getCoverage(), 1e-9);
+		EXPECT_NEAR(EdgeCut().getQuality(current, G), tracker.getCut(), 1e-9);
+	};
+	check();
+
+	for (index round = 0; round < 50; ++round) {
+		// node moves
+		for (index i = 0; i < 20; ++i) {
+			node u = G.randomNode();
+			if (Aux::Random::real() < 0.1) {
+				tracker.toSingleton(u);
+			} else {
+				tracker.moveToSubset(u, tracker.getPartition()[G.randomNode()]);
+			}
+		}
+		check();
+
+		// graph changes
+		std::vector<GraphEvent> batch;
+		std::set<std::pair<node, node>> touched; // at most one event per edge and batch
+		for (index i = 0; i < 20; ++i) {
+			node u = G.randomNode();
+			node v = G.randomNode();
+			if (touched.count(std::make_pair(std::min(u, v), std::max(u, v)))) {
+				continue;
+			}
+			touched.insert(std::make_pair(std::min(u, v), std::max(u, v)));
+			if (!G.hasEdge(u, v)) {
+				batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v, Aux::Random::real(0.5, 2.0));
+			} else if (i % 3 == 0) {
+				batch.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+			} else if (i % 3 == 1) {
+				batch.emplace_back(GraphEvent::EDGE_WEIGHT_UPDATE, u, v, Aux::Random::real(0.5, 2.0));
+			} else {
+				batch.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, 1.0);
+			}
+		}
+		batch.emplace_back(GraphEvent::NODE_ADDITION);
+		batch.emplace_back(GraphEvent::TIME_STEP);
+		tracker.update(batch);
+		check();
+	}
+}
+
+TEST_F(CommunityGTest, testDynPLM) {
+	METISGraphReader reader;
+	Modularity modularity;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	GraphUpdater updater(G);
+
+	DynPLM dynPLM(G);
+	dynPLM.run();
+
+	for (index round = 0; round < 5; ++round) {
+		std::vector<GraphEvent> batch;
+		std::set<std::pair<node, node>> touched; // at most one event per edge
+		for (index i = 0; i < 50; ++i) {
+			node u = G.randomNode();
+			node v = G.randomNode();
+			if (u != v && !G.hasEdge(u, v) && touched.insert(std::make_pair(std::min(u, v), std::max(u, v))).second) {
+				batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v, 1.0);
+			}
+			std::pair<node, node> e = G.randomEdge();
+			if (G.degree(e.first) > 1 && G.degree(e.second) > 1
+					&& touched.insert(std::make_pair(std::min(e.first, e.second), std::max(e.first, e.second))).second) {
+				batch.emplace_back(GraphEvent::EDGE_REMOVAL, e.first, e.second);
+			}
+		}
+		// isolate and remove a node of small degree that no other event of the batch touches
+		node x = G.randomNode();
+		bool removable = G.degree(x) <= 3;
+		for (auto& e : touched) {
+			removable = removable && e.first != x && e.second != x;
+		}
+		G.forNeighborsOf(x, [&](node y) {
+			removable = removable && G.degree(y) > 1;
+		});
+		if (removable) {
+			G.forNeighborsOf(x, [&](node y) {
+				touched.insert(std::make_pair(std::min(x, y), std::max(x, y)));
+				batch.emplace_back(GraphEvent::EDGE_REMOVAL, x, y);
+			});
+			batch.emplace_back(GraphEvent::NODE_REMOVAL, x);
+		}
+		node w = G.upperNodeIdBound(); // id of the new node
+		node neighbor = G.randomNode();
+		while (removable && neighbor == x) {
+			neighbor = G.randomNode();
+		}
+		batch.emplace_back(GraphEvent::NODE_ADDITION, w);
+		batch.emplace_back(GraphEvent::EDGE_ADDITION, w, neighbor, 1.0);
+		updater.update(batch);
+
+		dynPLM.update(batch);
+		Partition zeta = dynPLM.getPartition();
+		EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+
+		PLM plm(G, false, 1.0);
+		plm.run();
+		double modDyn = modularity.getQuality(zeta, G);
+		double modStatic = modularity.getQuality(plm.getPartition(), G);
+		INFO("modularity: ", modDyn, " (static: ", modStatic, ")");
+		// PLM itself is randomized and its modularity on this graph varies by about 0.002 between runs,
+		// the dynamic result stays within that range of a static rerun
+		EXPECT_GT(modDyn, modStatic - 0.005);
+	}
+}
+
 /*
 TEST_F(CommunityGTest, testLouvainParallel2Naive) {
 	count n = 1000;
@@ -196,6 +359,66 @@ TEST_F(CommunityGTest, testPLM) {
 
 }
 
+TEST_F(CommunityGTest, testPLMHashAffinity) {
+	METISGraphReader reader;
+	Modularity modularity;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+
+	// sequentially, the hash tables visit the neighboring communities in the same order as turbo mode
+	PLM turbo(G, true, 1.0, "none", 32, true);
+	turbo.run();
+	PLM hashed(G, true, 1.0, "none", 32, false, true, true);
+	hashed.run();
+	Partition zeta = hashed.getPartition();
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+	EXPECT_EQ(turbo.getPartition().getVector(), zeta.getVector());
+
+	PLM parallel(G, true, 1.0, "balanced", 32, false, true, true);
+	parallel.run();
+	Partition zeta2 = parallel.getPartition();
+
+	INFO("number of clusters: " , zeta2.numberOfSubsets());
+	INFO("modularity: " , modularity.getQuality(zeta2, G));
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta2));
+	EXPECT_GT(modularity.getQuality(zeta2, G), 0.8);
+}
+
+TEST_F(CommunityGTest, testPLMLeiden) {
+	METISGraphReader reader;
+	Modularity modularity;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+
+	PLM plm(G, false, 1.0);
+	plm.run();
+	double modPLM = modularity.getQuality(plm.getPartition(), G);
+
+	for (bool turbo : {false, true}) {
+		PLM leiden(G, false, 1.0, "balanced", 32, turbo, true, false, true);
+		leiden.run();
+		Partition zeta = leiden.getPartition();
+
+		INFO("number of clusters: " , zeta.numberOfSubsets());
+		INFO("modularity: " , modularity.getQuality(zeta, G), " (PLM: ", modPLM, ")");
+		EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+		EXPECT_GT(modularity.getQuality(zeta, G), modPLM - 0.01);
+
+		// every community is connected
+		UnionFind uf(G.upperNodeIdBound());
+		G.forEdges([&](node u, node v) {
+			if (zeta[u] == zeta[v]) {
+				uf.merge(u, v);
+			}
+		});
+		count components = 0;
+		G.forNodes([&](node u) {
+			if (uf.find(u) == u) {
+				components++;
+			}
+		});
+		EXPECT_EQ(zeta.numberOfSubsets(), components);
+	}
+}
+
 TEST_F(CommunityGTest, testDeletedNodesPLM) {
 	METISGraphReader reader;
 	Modularity modularity;
@@ -598,6 +821,52 @@ TEST_F(CommunityGTest, testClusteringIntersection) {
 	}
 }
 
+TEST_F(CommunityGTest, testContingencyTable) {
+	count n = 2000;
+	Graph G(n);
+	G.removeNode(17);
+	ClusteringGenerator generator;
+	Partition zeta = generator.makeRandomClustering(G, 30);
+	Partition eta = generator.makeRandomClustering(G, 70);
+	zeta[17] = none;
+	eta[17] = none;
+
+	std::map<std::pair<index, index>, count> expected;
+	G.forNodes([&](node u) {
+		expected[std::make_pair(zeta[u], eta[u])]++;
+	});
+
+	ContingencyTable table(G, zeta, eta);
+	EXPECT_EQ(n - 1, table.numberOfElements());
+	EXPECT_EQ(expected.size(), table.numberOfCells());
+	auto it = expected.begin();
+	index i = 0;
+	count pairsInBoth = 0;
+	table.forCells([&](index C, index D, count size) {
+		ASSERT_TRUE(it != expected.end());
+		EXPECT_EQ(it->first, std::make_pair(C, D));
+		EXPECT_EQ(it->second, size);
+		EXPECT_EQ(i, table.cellOf(C, D));
+		pairsInBoth += size * (size - 1) / 2;
+		++it;
+		++i;
+	});
+	EXPECT_EQ(pairsInBoth, table.pairsInBoth());
+
+	std::map<index, count> sizesZeta = zeta.subsetSizeMap();
+	for (auto size : sizesZeta) {
+		EXPECT_EQ(size.second, table.getFirstSizes()[size.first]);
+	}
+
+	// the table without the graph counts all elements assigned in both partitions
+	ContingencyTable elementTable(zeta, eta);
+	EXPECT_EQ(n - 1, elementTable.numberOfElements());
+	EXPECT_EQ(table.numberOfCells(), elementTable.numberOfCells());
+
+	AdjustedRandMeasure ari;
+	EXPECT_NEAR(0.0, ari.getDissimilarity(G, zeta, zeta), 1e-12);
+}
+
 TEST_F(CommunityGTest, testMakeNoncontinuousClustering) {
 	ClusteringGenerator generator;
 	// make complete graph
@@ -6,6 +6,7 @@
  */
 
 #include <set>
+#include <queue>
 
 #include "ConnectedComponents.h"
 #include "../structures/Partition.h"
@@ -13,30 +14,74 @@
 
 namespace NetworKit {
 
-ConnectedComponents::ConnectedComponents(const Graph& G) : G(G), hasRun(false) {
-	if (G.isDirected()) {
-		throw std::runtime_error("Error, connected components of directed graphs cannot be computed, use StronglyConnectedComponents for them.");
-	}
-}
+namespace {
 
-void ConnectedComponents::run() {
+// labels the components of G with 0, 1, ... and returns their number
+template<class GraphType>
+count labelComponents(const GraphType& G, Partition& component) {
 	DEBUG("initializing labels");
 	component = Partition(G.upperNodeIdBound(), none);
-	numComponents = 0;
+	count numComponents = 0;
+
+	// the component of a node with maximum degree is usually the giant one, label it with a parallel BFS
+	node hub = none;
+	G.forNodes([&](node u) {
+		if (hub == none || G.degree(u) > G.degree(hub)) {
+			hub = u;
+		}
+	});
+	if (hub != none) {
+		component.setUpperBound(1);
+		G.parallelBFSfrom(hub, [&](node v) {
+			component[v] = 0;
+		});
+		numComponents = 1;
+	}
 
-	// perform breadth-first searches
+	// perform sequential breadth-first searches for the remaining components, the labels serve as visited flags
+	std::queue<node> q;
 	G.forNodes([&](node u) {
 		if (component[u] == none) {
 			component.setUpperBound(numComponents+1);
 			index c = numComponents;
-			G.BFSfrom(u, [&](node v) {
-				component[v] = c;
-			});
-			assert (component[u] != none);
+			component[u] = c;
+			q.push(u);
+			while (!q.empty()) {
+				node v = q.front();
+				q.pop();
+				G.forNeighborsOf(v, [&](node w) {
+					if (component[w] == none) {
+						component[w] = c;
+						q.push(w);
+					}
+				});
+			}
 			++numComponents;
 		}
 	});
 
+	// the hub's component took id 0, number the components in the order of their first node as before
+	component.compact(true);
+
+	return numComponents;
+}
+
+}
+
+ConnectedComponents::ConnectedComponents(const Graph& G) : G(&G), csr(nullptr), hasRun(false) {
+	if (G.isDirected()) {
+		throw std::runtime_error("Error, connected components of directed graphs cannot be computed, use StronglyConnectedComponents for them.");
+	}
+}
+
+ConnectedComponents::ConnectedComponents(const CSRGraph& G) : G(nullptr), csr(&G), hasRun(false) {
+	if (G.isDirected()) {
+		throw std::runtime_error("Error, connected components of directed graphs cannot be computed, use StronglyConnectedComponents for them.");
+	}
+}
+
+void ConnectedComponents::run() {
+	numComponents = (csr != nullptr) ? labelComponents(*csr, component) : labelComponents(*G, component);
 	hasRun = true;
 }
 
@@ -53,8 +98,10 @@ std::vector<std::vector<node> > ConnectedComponents::getComponents() {
 	// transform partition into vector of unordered_set
 	std::vector<std::vector<node> > result(numComponents);
 
-	G.forNodes([&](node u) {
-		result[component[u]].push_back(u);
+	component.forEntries([&](index u, index c) {
+		if (c != none) {
+			result[c].push_back(u);
+		}
 	});
 
 	return result;
@@ -9,6 +9,7 @@
 #define CONNECTEDCOMPONENTS_H_
 
 #include "../graph/Graph.h"
+#include "../graph/CSRGraph.h"
 #include "../graph/BFS.h"
 #include "../structures/Partition.h"
 #include "../base/Algorithm.h"
@@ -29,6 +30,14 @@ public:
 	 */
 	ConnectedComponents(const Graph& G);
 
+	/**
+	 * Create ConnectedComponents class for the CSR snapshot @a G of a graph. The result is the same as for
+	 * the original graph.
+	 *
+	 * @param G The graph.
+	 */
+	ConnectedComponents(const CSRGraph& G);
+
 	/**
 	 * This method determines the connected components for the graph given in the constructor.
 	 */
@@ -68,7 +77,8 @@ public:
 
 
 private:
-	const Graph& G;
+	const Graph* G; //!< nullptr if constructed from a CSRGraph
+	const CSRGraph* csr; //!< nullptr if constructed from a Graph
 	Partition component;
 	count numComponents;
 	bool hasRun;
@@ -9,6 +9,9 @@
 #include "../structures/Partition.h"
 #include "../coarsening/ParallelPartitionCoarsening.h"
 #include "../auxiliary/Log.h"
+#include "../structures/ConcurrentUnionFind.h"
+
+#include <unordered_map>
 
 namespace NetworKit {
 
@@ -166,6 +169,65 @@ void ParallelConnectedComponents::runSequential() {
 	}
 }
 
+void ParallelConnectedComponents::runAfforest() {
+	if (G.isDirected()) {
+		throw std::runtime_error("algorithm does not accept directed graphs");
+	}
+
+	count z = G.upperNodeIdBound();
+	const count neighborRounds = 2;
+	ConcurrentUnionFind uf(z);
+
+	// link every node with its first neighbors, this already connects most of the giant component
+	DEBUG("linking sampled neighbors");
+	G.balancedParallelForNodes([&](node u) {
+		index i = 0;
+		G.forNeighborsOf(u, [&](node v) {
+			if (i++ < neighborRounds) {
+				uf.merge(u, v);
+			}
+		});
+	});
+	uf.compress();
+
+	// estimate the largest intermediate component from a sample of nodes
+	index largest = none;
+	if (G.numberOfNodes() > 0) {
+		std::unordered_map<index, count> frequency;
+		count maxFrequency = 0;
+		for (index i = 0; i < 1024; ++i) {
+			node u = G.randomNode();
+			index c = uf.find(u);
+			if (++frequency[c] > maxFrequency) {
+				maxFrequency = frequency[c];
+				largest = c;
+			}
+		}
+	}
+
+	// nodes outside of the largest component link along their remaining edges; the edges between the largest
+	// component and the others are seen from the other endpoint since the graph is undirected
+	DEBUG("linking remaining edges");
+	G.balancedParallelForNodes([&](node u) {
+		if (uf.find(u) == largest) {
+			return;
+		}
+		index i = 0;
+		G.forNeighborsOf(u, [&](node v) {
+			if (i++ >= neighborRounds) {
+				uf.merge(u, v);
+			}
+		});
+	});
+
+	component = uf.toPartition();
+	// remove nodes that do not exist from the partition so it doesn't report wrong numbers
+	component.parallelForEntries([&](node u, index s) {
+		if (!G.hasNode(u)) {
+			component[u] = none;
+		}
+	});
+}
 
 Partition ParallelConnectedComponents::getPartition() {
 	return this->component;
@@ -34,6 +34,15 @@ public:
 	 */
 	void run();
 
+	/**
+	 * This method determines the connected components for the graph g with a concurrent union-find.
+	 * Following the Afforest scheme, every node is first linked with its first two neighbors; the largest
+	 * component is then estimated from a sample of nodes and its members skip the remaining edges.
+	 * The number of rounds does not depend on the diameter, unlike the label propagation of run().
+	 * See Sutton et al., "Optimizing Parallel Graph Connectivity Computation via Subgraph Sampling", IPDPS 2018.
+	 */
+	void runAfforest();
+
 	/**
 	 * This method returns the number of connected components.
 	 */
@@ -7,6 +7,9 @@
 
 #include <stack>
 #include <functional>
+#include <algorithm>
+#include <vector>
+#include <omp.h>
 
 #include "StronglyConnectedComponents.h"
 #include "../structures/Partition.h"
@@ -14,6 +17,41 @@
 
 namespace NetworKit {
 
+namespace {
+
+// level-synchronous parallel search from s along outgoing (forward) or incoming edges, restricted to the
+// nodes accepted by filter; reached nodes are marked in reached
+template<typename F>
+void parallelSearch(const Graph& G, node s, bool forward, std::vector<char>& reached, F filter) {
+	std::vector<node> frontier {s};
+	reached[s] = 1;
+	while (!frontier.empty()) {
+		std::vector<node> next;
+		#pragma omp parallel
+		{
+			std::vector<node> localNext;
+			auto visit = [&](node w) {
+				if (!reached[w] && filter(w) && __sync_bool_compare_and_swap(&reached[w], 0, 1)) {
+					localNext.push_back(w);
+				}
+			};
+			#pragma omp for schedule(guided) nowait
+			for (index i = 0; i < frontier.size(); ++i) {
+				if (forward) {
+					G.forNeighborsOf(frontier[i], visit);
+				} else {
+					G.forInNeighborsOf(frontier[i], visit);
+				}
+			}
+			#pragma omp critical
+			next.insert(next.end(), localNext.begin(), localNext.end());
+		}
+		frontier.swap(next);
+	}
+}
+
+} /* namespace */
+
 StronglyConnectedComponents::StronglyConnectedComponents(const Graph& G) : G(G) {
 
 }
@@ -64,6 +102,256 @@ void StronglyConnectedComponents::run() {
 	});
 }
 
+void StronglyConnectedComponents::runParallel() {
+	const count z = G.upperNodeIdBound();
+	std::vector<index> comp(z, none); // representative node of the component, none while unassigned
+
+	auto active = [&](node v) {
+		return comp[v] == none;
+	};
+
+	// trimming: a node without active in- or out-neighbors forms a singleton component
+	DEBUG("trimming");
+	for (index round = 0; round < 3; ++round) {
+		count trimmed = 0;
+		G.balancedParallelForNodes([&](node v) {
+			if (!active(v)) {
+				return;
+			}
+			bool hasOut = false;
+			bool hasIn = false;
+			G.forNeighborsOf(v, [&](node w) {
+				hasOut = hasOut || (w != v && active(w));
+			});
+			G.forInNeighborsOf(v, [&](node w) {
+				hasIn = hasIn || (w != v && active(w));
+			});
+			if (!hasOut || !hasIn) {
+				comp[v] = v;
+				#pragma omp atomic
+				++trimmed;
+			}
+		});
+		if (trimmed == 0) {
+			break;
+		}
+	}
+
+	// forward-backward search from the pivot with the largest product of degrees, usually hits the giant component
+	DEBUG("forward-backward search");
+	node pivot = none;
+	count pivotScore = 0;
+	G.forNodes([&](node v) {
+		count score = (G.degreeOut(v) + 1) * (G.degreeIn(v) + 1);
+		if (active(v) && (pivot == none || score > pivotScore)) {
+			pivot = v;
+			pivotScore = score;
+		}
+	});
+	if (pivot != none) {
+		std::vector<char> forwardReached(z, 0);
+		std::vector<char> backwardReached(z, 0);
+		parallelSearch(G, pivot, true, forwardReached, active);
+		parallelSearch(G, pivot, false, backwardReached, [&](node v) {
+			return forwardReached[v] != 0;
+		});
+		G.parallelForNodes([&](node v) {
+			if (backwardReached[v]) {
+				comp[v] = pivot;
+			}
+		});
+	}
+
+	// coloring for the remaining nodes
+	DEBUG("coloring");
+	std::vector<node> color(z, none);
+	while (true) {
+		count remaining = 0;
+		G.parallelForNodes([&](node v) {
+			if (active(v)) {
+				color[v] = v;
+				#pragma omp atomic
+				++remaining;
+			}
+		});
+		if (remaining == 0) {
+			break;
+		}
+
+		// propagate the maximum color along the edges until nothing changes
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			G.balancedParallelForNodes([&](node v) {
+				if (!active(v)) {
+					return;
+				}
+				node c = color[v];
+				G.forNeighborsOf(v, [&](node w) {
+					if (!active(w)) {
+						return;
+					}
+					node old = color[w];
+					while (old < c) {
+						if (__sync_bool_compare_and_swap(&color[w], old, c)) {
+							changed = true;
+							break;
+						}
+						old = color[w];
+					}
+				});
+			});
+		}
+
+		// the component of a root r consists of the nodes of color r that reach r
+		std::vector<node> roots;
+		G.forNodes([&](node v) {
+			if (active(v) && color[v] == v) {
+				roots.push_back(v);
+			}
+		});
+		#pragma omp parallel
+		{
+			std::vector<node> queue;
+			#pragma omp for schedule(dynamic, 1)
+			for (index i = 0; i < roots.size(); ++i) {
+				node r = roots[i];
+				queue.assign(1, r);
+				comp[r] = r;
+				for (index j = 0; j < queue.size(); ++j) {
+					G.forInNeighborsOf(queue[j], [&](node w) {
+						if (comp[w] == none && color[w] == r) {
+							comp[w] = r;
+							queue.push_back(w);
+						}
+					});
+				}
+			}
+		}
+	}
+
+	// temporary ids in the order of the smallest node of every component
+	Partition temp(z);
+	temp.setUpperBound(z);
+	G.parallelForNodes([&](node v) {
+		temp[v] = comp[v];
+	});
+	temp.compact(true);
+	const count k = temp.upperBound();
+	Partition::MemberIndex members = temp.getMemberIndex();
+
+	// number the components in a reverse topological order of the condensation, as Tarjan's algorithm in run()
+	// completes them: components are peeled off in rounds once all components they have edges to are numbered,
+	// within a round by their smallest node
+	DEBUG("numbering");
+	std::vector<count> remaining(k, 0); // edges to components that are not numbered yet
+	G.balancedParallelForNodes([&](node u) {
+		count out = 0;
+		G.forNeighborsOf(u, [&](node v) {
+			if (temp[v] != temp[u]) {
+				++out;
+			}
+		});
+		if (out > 0) {
+			#pragma omp atomic
+			remaining[temp[u]] += out;
+		}
+	});
+	std::vector<index> order;
+	order.reserve(k);
+	for (index c = 0; c < k; ++c) {
+		if (remaining[c] == 0) {
+			order.push_back(c);
+		}
+	}
+	index roundBegin = 0;
+	while (roundBegin < order.size()) {
+		const index roundEnd = order.size();
+		std::vector<index> next;
+		#pragma omp parallel
+		{
+			std::vector<index> localNext;
+			#pragma omp for schedule(guided) nowait
+			for (index i = roundBegin; i < roundEnd; ++i) {
+				index c = order[i];
+				members.forMembers(c, [&](node v) {
+					G.forInNeighborsOf(v, [&](node u) {
+						index d = temp[u];
+						if (d != c) {
+							count left;
+							#pragma omp atomic capture
+							left = --remaining[d];
+							if (left == 0) {
+								localNext.push_back(d);
+							}
+						}
+					});
+				});
+			}
+			#pragma omp critical
+			next.insert(next.end(), localNext.begin(), localNext.end());
+		}
+		std::sort(next.begin(), next.end());
+		order.insert(order.end(), next.begin(), next.end());
+		roundBegin = roundEnd;
+	}
+	assert(order.size() == k);
+
+	// ids start at 1 as those handed out by Partition::toSingleton in run()
+	std::vector<index> id(k);
+	#pragma omp parallel for
+	for (index i = 0; i < k; ++i) {
+		id[order[i]] = i + 1;
+	}
+	component = Partition(z);
+	component.setUpperBound(k + 1);
+	G.parallelForNodes([&](node v) {
+		component[v] = id[temp[v]];
+	});
+}
+
+Graph StronglyConnectedComponents::getCondensation() {
+	// map the component ids to consecutive node ids, keeping their order
+	std::vector<index> nodeOfComponent(component.upperBound(), none);
+	G.forNodes([&](node v) {
+		nodeOfComponent[component[v]] = 0;
+	});
+	count k = 0;
+	for (index c = 0; c < nodeOfComponent.size(); ++c) {
+		if (nodeOfComponent[c] != none) {
+			nodeOfComponent[c] = k++;
+		}
+	}
+
+	// collect the edges between different components, each thread removes its own duplicates first
+	std::vector<std::vector<std::pair<node, node>>> threadEdges(omp_get_max_threads());
+	G.balancedParallelForNodes([&](node u) {
+		auto& edges = threadEdges[omp_get_thread_num()];
+		node cu = nodeOfComponent[component[u]];
+		G.forNeighborsOf(u, [&](node v) {
+			node cv = nodeOfComponent[component[v]];
+			if (cu != cv) {
+				edges.emplace_back(cu, cv);
+			}
+		});
+	});
+	std::vector<std::pair<node, node>> edges;
+	for (auto& local : threadEdges) {
+		std::sort(local.begin(), local.end());
+		local.erase(std::unique(local.begin(), local.end()), local.end());
+		edges.insert(edges.end(), local.begin(), local.end());
+		std::vector<std::pair<node, node>>().swap(local);
+	}
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	Graph condensation(k, false, true);
+	for (auto& e : edges) {
+		condensation.addEdge(e.first, e.second);
+	}
+	return condensation;
+}
+
 Partition StronglyConnectedComponents::getPartition() {
 	return this->component;
 }
@@ -22,10 +22,27 @@ public:
 	StronglyConnectedComponents(const Graph& G);
 
 	/**
-	 * This method determines the connected components for the graph g.
+	 * This method determines the connected components for the graph g. The components are numbered
+	 * 1 to numberOfComponents() in the order in which Tarjan's algorithm completes them, which is a reverse
+	 * topological order of the condensation: every edge between two components goes to the smaller id.
 	 */
 	void run();
 
+	/**
+	 * This method determines the strongly connected components in parallel. Nodes without incoming or
+	 * outgoing edges are trimmed first, the component of a high-degree pivot is found as the intersection
+	 * of a forward and a backward search, and the rest is resolved by coloring: the largest node id that
+	 * reaches a node is propagated along the edges, and each color root collects its component with a
+	 * backward search among the nodes of its color.
+	 * See Slota et al., "BFS and Coloring-based Parallel Algorithms for Strongly Connected Components and
+	 * Related Problems", IPDPS 2014.
+	 *
+	 * The result is the same partition as the one of run(). The ids are also 1 to numberOfComponents() in a reverse
+	 * topological order of the condensation, with ties broken by the smallest node. They can differ from those of
+	 * run(), which depend on the order of its depth-first search.
+	 */
+	void runParallel();
+
 	/**
 	 * This method returns the number of connected components.
 	 */
@@ -44,6 +61,13 @@ public:
 	 */
 	Partition getPartition();
 
+	/**
+	 * Returns the condensation of the graph, a directed acyclic graph with one node per strongly connected
+	 * component and an edge between two components if the graph has an edge from the first to the second.
+	 * Node i of the condensation stands for the component with the i-th smallest id.
+	 */
+	Graph getCondensation();
+
 
 private:
 	const Graph& G;
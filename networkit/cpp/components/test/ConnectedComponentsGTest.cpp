@@ -11,12 +11,14 @@
 #include "../ConnectedComponents.h"
 #include "../ParallelConnectedComponents.h"
 #include "../StronglyConnectedComponents.h"
+#include "../../graph/CSRGraph.h"
 
 #include "../../distance/Diameter.h"
 #include "../../io/METISGraphReader.h"
 #include "../../generators/HavelHakimiGenerator.h"
 #include "../../auxiliary/Log.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 
 namespace NetworKit {
 
@@ -57,6 +59,27 @@ namespace NetworKit {
  }
 
 
+TEST_F(ConnectedComponentsGTest, testConnectedComponentIdsInNodeOrder) {
+	// the component of the hub 5 is labeled first, but the ids follow the first node of every component
+	Graph G(8);
+	G.addEdge(0, 1);
+	G.addEdge(2, 3);
+	G.addEdge(5, 4);
+	G.addEdge(5, 6);
+	G.addEdge(5, 7);
+
+	ConnectedComponents cc(G);
+	cc.run();
+	EXPECT_EQ(3u, cc.numberOfComponents());
+	EXPECT_EQ(0u, cc.componentOfNode(0));
+	EXPECT_EQ(0u, cc.componentOfNode(1));
+	EXPECT_EQ(1u, cc.componentOfNode(2));
+	EXPECT_EQ(1u, cc.componentOfNode(3));
+	for (node u = 4; u < 8; ++u) {
+		EXPECT_EQ(2u, cc.componentOfNode(u));
+	}
+}
+
 TEST_F(ConnectedComponentsGTest, testConnectedComponents) {
 	// construct graph
 	METISGraphReader reader;
@@ -114,6 +137,36 @@ TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsWithDeletedNodes
 
 }
 
+TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsAfforest) {
+	// sparse enough for a giant component next to many small ones
+	Graph G = ErdosRenyiGenerator(5000, 0.0003).generate();
+	for (node u = 0; u < 100; ++u) {
+		G.forNeighborsOf(u, [&](node v) {
+			G.removeEdge(u, v);
+		});
+		G.removeNode(u);
+	}
+
+	ConnectedComponents cc(G);
+	cc.run();
+	ParallelConnectedComponents pcc(G);
+	pcc.runAfforest();
+	EXPECT_EQ(cc.numberOfComponents(), pcc.numberOfComponents());
+
+	Partition expected = cc.getPartition();
+	Partition actual = pcc.getPartition();
+	G.forEdges([&](node u, node v) {
+		EXPECT_EQ(actual[u], actual[v]);
+	});
+	G.forNodes([&](node u) {
+		G.forNodes([&](node v) {
+			if (u < v && u % 50 == 0) {
+				EXPECT_EQ(expected[u] == expected[v], actual[u] == actual[v]);
+			}
+		});
+	});
+}
+
 TEST_F(ConnectedComponentsGTest, benchConnectedComponents) {
 	// construct graph
 	METISGraphReader reader;
@@ -186,6 +239,153 @@ TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponents) {
 }
 
 
+TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponentsParallel) {
+	// the graph of testStronglyConnectedComponents, components {0,1,4}, {2,3}, {5,6}, {7}
+	Graph G(8, false, true);
+	G.addEdge(0, 4);
+	G.addEdge(1, 0);
+	G.addEdge(2, 1);
+	G.addEdge(2, 3);
+	G.addEdge(3, 2);
+	G.addEdge(4, 1);
+	G.addEdge(5, 1);
+	G.addEdge(5, 4);
+	G.addEdge(5, 6);
+	G.addEdge(6, 2);
+	G.addEdge(6, 5);
+	G.addEdge(7, 3);
+	G.addEdge(7, 6);
+	G.addEdge(7, 7);
+
+	StronglyConnectedComponents scc(G);
+	scc.runParallel();
+	EXPECT_EQ(4u, scc.numberOfComponents());
+	EXPECT_EQ(scc.componentOfNode(0), scc.componentOfNode(1));
+	EXPECT_EQ(scc.componentOfNode(0), scc.componentOfNode(4));
+	EXPECT_EQ(scc.componentOfNode(2), scc.componentOfNode(3));
+	EXPECT_EQ(scc.componentOfNode(5), scc.componentOfNode(6));
+	EXPECT_NE(scc.componentOfNode(0), scc.componentOfNode(2));
+	EXPECT_NE(scc.componentOfNode(0), scc.componentOfNode(5));
+	EXPECT_NE(scc.componentOfNode(0), scc.componentOfNode(7));
+	EXPECT_NE(scc.componentOfNode(2), scc.componentOfNode(5));
+	EXPECT_NE(scc.componentOfNode(2), scc.componentOfNode(7));
+	EXPECT_NE(scc.componentOfNode(5), scc.componentOfNode(7));
+
+	// reverse topological order: the sink {0,1,4} first, then {2,3}, {5,6} and {7}
+	EXPECT_EQ(1u, scc.componentOfNode(0));
+	EXPECT_EQ(2u, scc.componentOfNode(2));
+	EXPECT_EQ(3u, scc.componentOfNode(5));
+	EXPECT_EQ(4u, scc.componentOfNode(7));
+
+	// node i of the condensation stands for the component with the i-th smallest id, that is id i + 1
+	Graph C = scc.getCondensation();
+	EXPECT_EQ(4u, C.numberOfNodes());
+	EXPECT_TRUE(C.isDirected());
+	EXPECT_EQ(5u, C.numberOfEdges());
+	EXPECT_TRUE(C.hasEdge(1, 0));
+	EXPECT_TRUE(C.hasEdge(2, 0));
+	EXPECT_TRUE(C.hasEdge(2, 1));
+	EXPECT_TRUE(C.hasEdge(3, 1));
+	EXPECT_TRUE(C.hasEdge(3, 2));
+}
+
+TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponentsParallelRandom) {
+	// sparse random digraph with a giant component, many small ones and some deleted nodes
+	Graph G = ErdosRenyiGenerator(3000, 0.0012, true).generate();
+	for (node u = 0; u < 30; ++u) {
+		std::vector<std::pair<node, node>> incident;
+		G.forNeighborsOf(u, [&](node v) {
+			incident.emplace_back(u, v);
+		});
+		G.forInNeighborsOf(u, [&](node v) {
+			incident.emplace_back(v, u);
+		});
+		for (auto& e : incident) {
+			if (G.hasEdge(e.first, e.second)) {
+				G.removeEdge(e.first, e.second);
+			}
+		}
+		G.removeNode(u);
+	}
+
+	StronglyConnectedComponents sequential(G);
+	sequential.run();
+	StronglyConnectedComponents parallel(G);
+	parallel.runParallel();
+	ASSERT_EQ(sequential.numberOfComponents(), parallel.numberOfComponents());
+
+	// both partitions must induce the same equivalence relation
+	Partition expected = sequential.getPartition();
+	Partition actual = parallel.getPartition();
+	std::vector<index> map(expected.upperBound(), none);
+	G.forNodes([&](node v) {
+		if (map[expected[v]] == none) {
+			map[expected[v]] = actual[v];
+		}
+		EXPECT_EQ(map[expected[v]], actual[v]);
+	});
+
+	// both use the ids 1 to k in a reverse topological order of the condensation
+	for (Partition* p : {&expected, &actual}) {
+		const count k = parallel.numberOfComponents();
+		EXPECT_EQ(k + 1, p->upperBound());
+		std::vector<bool> used(k + 1, false);
+		G.forNodes([&](node v) {
+			ASSERT_GE((*p)[v], 1u);
+			ASSERT_LE((*p)[v], k);
+			used[(*p)[v]] = true;
+		});
+		EXPECT_EQ(k, count(std::count(used.begin(), used.end(), true)));
+		G.forEdges([&](node u, node v) {
+			if ((*p)[u] != (*p)[v]) {
+				EXPECT_GT((*p)[u], (*p)[v]);
+			}
+		});
+	}
+
+	// the condensation is acyclic, so each of its nodes is a component of its own
+	Graph C = parallel.getCondensation();
+	EXPECT_EQ(parallel.numberOfComponents(), C.numberOfNodes());
+	StronglyConnectedComponents condensationComponents(C);
+	condensationComponents.run();
+	EXPECT_EQ(C.numberOfNodes(), condensationComponents.numberOfComponents());
+	G.forEdges([&](node u, node v) {
+		if (actual[u] != actual[v]) {
+			EXPECT_TRUE(C.hasEdge(actual[u] - 1, actual[v] - 1));
+		}
+	});
+}
+
+TEST_F(ConnectedComponentsGTest, testConnectedComponentsOnCSRGraph) {
+	// a giant component, small ones, isolated nodes and some deleted nodes
+	Graph G = ErdosRenyiGenerator(3000, 0.0008, false).generate();
+	for (node u = 0; u < 30; ++u) {
+		std::vector<node> neighbors;
+		G.forNeighborsOf(u, [&](node v) {
+			neighbors.push_back(v);
+		});
+		for (node v : neighbors) {
+			G.removeEdge(u, v);
+		}
+		G.removeNode(u);
+	}
+	CSRGraph C(G);
+
+	ConnectedComponents onGraph(G);
+	onGraph.run();
+	ConnectedComponents onCSR(C);
+	onCSR.run();
+
+	ASSERT_EQ(onGraph.numberOfComponents(), onCSR.numberOfComponents());
+	EXPECT_GT(onCSR.numberOfComponents(), 1u);
+	Partition expected = onGraph.getPartition();
+	Partition actual = onCSR.getPartition();
+	for (node v = 0; v < G.upperNodeIdBound(); ++v) {
+		EXPECT_EQ(expected[v], actual[v]);
+	}
+	EXPECT_EQ(onGraph.getComponents(), onCSR.getComponents());
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
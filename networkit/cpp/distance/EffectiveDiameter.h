@@ -19,8 +19,9 @@ namespace NetworKit {
 class EffectiveDiameter {
 
 	/*
-	these are variatons of the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining
+	the approximations follow the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining
 	in Massive Graphs" by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
+	with the HyperLogLog counters of HyperBall instead of the original bitmasks
 	*/
 public:
 	/**
@@ -29,8 +30,8 @@ public:
 	*
 	* @param G the given graph
 	* @param ratio the ratio of nodes that should be connected (0,1]
-	* @param k the number of parallel approximations to get a more robust result
-	* @param r the amount of bits that are added to the length of the bitmask to improve the accuracy
+	* @param k the number of registers per counter, rounded up to a power of two between 16 and 65536
+	* @param r unused, the counters need no additional bits
 	* @return the approximated effective diameter of the graph
 	*/
 	static double effectiveDiameter(const Graph& G, const double ratio=0.9, const count k=64, const count r=7);
@@ -48,8 +49,8 @@ public:
 	* the hop plot is the set of pairs (d, g(g)) for each natural number d and where g(d) is the fraction of connected node pairs whose shortest connecting path has length at most d
 	* @param G the given graph
 	* @param maxDistance the maximum path length that shall be considered. set 0 for infinite
-	* @param k the number of parallel approximations to get a more robust result
-	* @param r the amount of bits that are added to the length of the bitmask to improve the accuracy
+	* @param k the number of registers per counter, rounded up to a power of two between 16 and 65536
+	* @param r unused, the counters need no additional bits
 	* @return the approximated hop-plot of the graph
 	*/
 	static std::map<count, double> hopPlot(const Graph& G, const count maxDistance=0, const count k=64, const count r=7);
@@ -0,0 +1,195 @@
+/*
+ * HyperBall.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "HyperBall.h"
+#include "../auxiliary/Random.h"
+
+#include <math.h>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <omp.h>
+
+namespace NetworKit {
+
+namespace {
+
+uint64_t mix(uint64_t x) {
+	// finalizer of splitmix64, maps consecutive node ids to independent looking hash values
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+struct InversePowers {
+	double value[65];
+
+	InversePowers() {
+		for (count i = 0; i < 65; ++i) {
+			value[i] = ldexp(1.0, -(int) i);
+		}
+	}
+};
+
+const InversePowers inversePowers;
+
+} // namespace
+
+HyperBall::HyperBall(const Graph& G, count log2m, count maxDistance) : G(G), log2m(log2m), maxDistance(maxDistance), registers(1 << log2m) {
+	if (log2m < 4 || log2m > 16) {
+		throw std::runtime_error("the number of registers per counter must be between 2^4 and 2^16");
+	}
+}
+
+void HyperBall::initialize() {
+	const count z = G.upperNodeIdBound();
+	const uint64_t seed = Aux::Random::integer();
+	current.assign(z * registers, 0);
+	nextChanged.assign(z, 0);
+	size.assign(z, 0.0);
+	G.parallelForNodes([&](node v) {
+		// the first log2m bits select the register, the position of the first one bit in the rest is stored
+		uint64_t hash = mix(seed ^ v);
+		uint64_t rest = hash << log2m;
+		uint8_t rank = rest == 0 ? 64 - log2m + 1 : __builtin_clzll(rest) + 1;
+		current[v * registers + (hash >> (64 - log2m))] = rank;
+		nextChanged[v] = 1;
+		size[v] = 1;
+	});
+	next = current;
+	changed.assign(z, 0);
+	previousSize = size;
+	neighborhoodFunction.assign(1, G.numberOfNodes());
+}
+
+bool HyperBall::step() {
+	const count z = G.upperNodeIdBound();
+	const double n = G.numberOfNodes();
+	changed.swap(nextChanged);
+	count updated = 0;
+	double sum = 0;
+	#pragma omp parallel for schedule(guided) reduction(+:updated,sum)
+	for (node v = 0; v < z; ++v) {
+		if (!G.hasNode(v)) continue;
+		const uint8_t* source = &current[v * registers];
+		uint8_t* target = &next[v * registers];
+		bool dirty = changed[v]; // otherwise, target still equals source from the round before
+		nextChanged[v] = 0;
+		// only counters that changed in the last round can add anything new
+		G.forNeighborsOf(v, [&](node u) {
+			if (!changed[u]) return;
+			if (dirty) {
+				std::copy(source, source + registers, target);
+				dirty = false;
+			}
+			const uint8_t* neighbor = &current[u * registers];
+			for (index j = 0; j < registers; ++j) {
+				target[j] = std::max(target[j], neighbor[j]);
+			}
+			nextChanged[v] = 1;
+		});
+		if (dirty) {
+			std::copy(source, source + registers, target);
+		}
+		if (nextChanged[v]) {
+			nextChanged[v] = std::memcmp(source, target, registers) != 0;
+		}
+		if (nextChanged[v]) {
+			previousSize[v] = size[v];
+			size[v] = std::max(size[v], std::min(n, estimate(target)));
+			updated++;
+		}
+		sum += size[v];
+	}
+	current.swap(next);
+	if (updated == 0) {
+		return false;
+	}
+	neighborhoodFunction.push_back(sum);
+	return true;
+}
+
+double HyperBall::estimate(const uint8_t* counter) const {
+	const double m = registers;
+	double sum = 0;
+	count zeros = 0;
+	for (index j = 0; j < registers; ++j) {
+		sum += inversePowers.value[counter[j]];
+		zeros += counter[j] == 0;
+	}
+	double alpha;
+	switch (registers) {
+	case 16:
+		alpha = 0.673;
+		break;
+	case 32:
+		alpha = 0.697;
+		break;
+	case 64:
+		alpha = 0.709;
+		break;
+	default:
+		alpha = 0.7213 / (1 + 1.079 / m);
+	}
+	double result = alpha * m * m / sum;
+	if (result <= 2.5 * m && zeros > 0) {
+		// small range correction by linear counting
+		result = m * log(m / zeros);
+	}
+	return result;
+}
+
+void HyperBall::run() {
+	const count z = G.upperNodeIdBound();
+	harmonic.assign(z, 0.0);
+	farness.assign(z, 0.0);
+	iterate([&](count t, node v, double before, double after) {
+		harmonic[v] += (after - before) / t;
+		farness[v] += (after - before) * t;
+	});
+	hasRun = true;
+}
+
+std::vector<double> HyperBall::getHarmonic() const {
+	assureFinished();
+	return harmonic;
+}
+
+std::vector<double> HyperBall::getCloseness(bool normalized) const {
+	assureFinished();
+	std::vector<double> closeness(G.upperNodeIdBound(), 0.0);
+	G.parallelForNodes([&](node v) {
+		if (farness[v] > 0) {
+			closeness[v] = (normalized ? size[v] - 1 : 1.0) / farness[v];
+		}
+	});
+	return closeness;
+}
+
+std::vector<double> HyperBall::getFarness() const {
+	assureFinished();
+	return farness;
+}
+
+std::vector<double> HyperBall::getReachable() const {
+	assureFinished();
+	return size;
+}
+
+std::vector<double> HyperBall::getNeighborhoodFunction() const {
+	assureFinished();
+	return neighborhoodFunction;
+}
+
+std::string HyperBall::toString() const {
+	std::stringstream stream;
+	stream << "HyperBall(log2m=" << log2m << ")";
+	return stream.str();
+}
+
+} /* namespace NetworKit */
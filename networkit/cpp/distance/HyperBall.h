@@ -0,0 +1,130 @@
+/*
+ * HyperBall.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef HYPERBALL_H_
+#define HYPERBALL_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Approximates the size of the ball of every radius t around every node, i.e. the number of nodes reachable
+ * in at most t steps, according to the algorithm described in
+ * Paolo Boldi and Sebastiano Vigna: In-Core Computation of Geometric Centralities with HyperBall: A Hundred Billion Nodes and Beyond
+ *
+ * Every node has a HyperLogLog counter with 2^log2m one-byte registers. The counters of all nodes are stored
+ * in one contiguous array, so the union of two counters is an element-wise maximum over two byte ranges.
+ * In round t, the counter of every node becomes the union of its own counter and the counters of its
+ * (out-)neighbors from round t-1. Only nodes with a neighbor whose counter changed in the last round are updated,
+ * and the algorithm stops as soon as no counter changes. From the differences of the estimated ball sizes,
+ * run() computes the harmonic centrality, the farness and the number of reachable nodes of every node and the
+ * neighborhood function of the graph. Unlike Closeness, this works on disconnected graphs.
+ * Edge weights are ignored. The relative standard error of each estimate is about 1.04 / sqrt(2^log2m).
+ */
+class HyperBall: public Algorithm {
+
+public:
+
+	/**
+	 * @param G The graph.
+	 * @param log2m Logarithm of the number of registers per counter, between 4 and 16.
+	 * @param maxDistance The largest radius to consider, 0 for no limit.
+	 */
+	HyperBall(const Graph& G, count log2m = 6, count maxDistance = 0);
+
+	/**
+	 * Computes harmonic centrality, farness, reachable nodes and the neighborhood function.
+	 */
+	void run() override;
+
+	/**
+	 * Runs the iteration without computing any results. After every round t, calls @a handle(t, v, before, after)
+	 * in parallel for every node v whose counter changed in this round, where @a before and @a after are the
+	 * estimated sizes of its balls of radius t-1 and t.
+	 */
+	template<typename L> void iterate(L handle);
+
+	/**
+	 * @return The approximate harmonic centrality, the sum of 1 / d(v, u) over all nodes u != v reachable from v.
+	 */
+	std::vector<double> getHarmonic() const;
+
+	/**
+	 * @return The approximate closeness of every node with respect to the nodes reachable from it. If @a normalized
+	 * is false, this is 1 / farness, as Closeness computes it, otherwise (reachable - 1) / farness.
+	 * Nodes that reach no other node have closeness 0.
+	 */
+	std::vector<double> getCloseness(bool normalized = false) const;
+
+	/**
+	 * @return The approximate sum of the distances to all nodes reachable from each node.
+	 */
+	std::vector<double> getFarness() const;
+
+	/**
+	 * @return The approximate number of nodes reachable from each node, including the node itself.
+	 */
+	std::vector<double> getReachable() const;
+
+	/**
+	 * @return The approximate neighborhood function: at index t, the number of node pairs (u, v) with d(u, v) <= t.
+	 */
+	std::vector<double> getNeighborhoodFunction() const;
+
+	virtual std::string toString() const override;
+
+	virtual bool isParallel() const override {
+		return true;
+	}
+
+private:
+
+	const Graph& G;
+	count log2m;
+	count maxDistance;
+
+	count registers; // 2^log2m
+	std::vector<uint8_t> current; // the counter of node v is current[v * registers, (v + 1) * registers)
+	std::vector<uint8_t> next;
+	std::vector<char> changed; // whether the counter of a node changed in the last round
+	std::vector<char> nextChanged; // whether it changed in the current round
+	std::vector<double> size; // estimated size of the current ball
+	std::vector<double> previousSize;
+
+	std::vector<double> harmonic;
+	std::vector<double> farness;
+	std::vector<double> neighborhoodFunction;
+
+	void initialize();
+	bool step();
+	double estimate(const uint8_t* counter) const;
+};
+
+template<typename L>
+void HyperBall::iterate(L handle) {
+	initialize();
+	for (count t = 1; maxDistance == 0 || t <= maxDistance; ++t) {
+		if (!step()) {
+			break;
+		}
+		const count z = G.upperNodeIdBound();
+		#pragma omp parallel for schedule(guided)
+		for (node v = 0; v < z; ++v) {
+			if (nextChanged[v]) {
+				handle(t, v, previousSize[v], size[v]);
+			}
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* HYPERBALL_H_ */
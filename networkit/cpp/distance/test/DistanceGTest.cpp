@@ -10,6 +10,9 @@
 
 #include "../Diameter.h"
 #include "../EffectiveDiameter.h"
+#include "../HyperBall.h"
+#include "../../graph/BFS.h"
+#include "../../auxiliary/Random.h"
 
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../../generators/ErdosRenyiGenerator.h"
@@ -212,6 +215,69 @@ TEST_F(DistanceGTest, testHopPlot) {
 	}
 }
 
+TEST_F(DistanceGTest, testHyperBall) {
+	Aux::Random::setSeed(42, false);
+	// disconnected with isolated nodes
+	Graph G = ErdosRenyiGenerator(500, 0.005).generate();
+	const count n = G.numberOfNodes();
+
+	std::vector<double> harmonic(n, 0.0), farness(n, 0.0), reachable(n, 0.0);
+	std::vector<double> neighborhoodFunction;
+	G.forNodes([&](node u) {
+		BFS bfs(G, u);
+		bfs.run();
+		G.forNodes([&](node v) {
+			edgeweight d = bfs.distance(v);
+			if (d == std::numeric_limits<edgeweight>::max()) return;
+			count h = (count) d;
+			reachable[u]++;
+			farness[u] += d;
+			if (u != v) {
+				harmonic[u] += 1 / d;
+			}
+			if (neighborhoodFunction.size() <= h) {
+				neighborhoodFunction.resize(h + 1, 0.0);
+			}
+			neighborhoodFunction[h]++;
+		});
+	});
+	for (index h = 1; h < neighborhoodFunction.size(); ++h) {
+		neighborhoodFunction[h] += neighborhoodFunction[h - 1];
+	}
+
+	HyperBall hyperBall(G, 10);
+	hyperBall.run();
+	std::vector<double> estimatedHarmonic = hyperBall.getHarmonic();
+	std::vector<double> estimatedFarness = hyperBall.getFarness();
+	std::vector<double> estimatedReachable = hyperBall.getReachable();
+	std::vector<double> closeness = hyperBall.getCloseness(true);
+	// 2^10 registers give a standard error of about 3%, in tiny components a register collision can hide a node
+	const double tol = 0.15;
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(reachable[u], estimatedReachable[u], tol * reachable[u] + 1);
+		EXPECT_NEAR(harmonic[u], estimatedHarmonic[u], tol * harmonic[u] + 1);
+		EXPECT_NEAR(farness[u], estimatedFarness[u], tol * farness[u] + 2);
+		if (estimatedFarness[u] > 0) {
+			EXPECT_NEAR((estimatedReachable[u] - 1) / estimatedFarness[u], closeness[u], 1e-9);
+		} else {
+			EXPECT_EQ(0.0, closeness[u]);
+		}
+	});
+
+	std::vector<double> estimatedFunction = hyperBall.getNeighborhoodFunction();
+	ASSERT_LE(estimatedFunction.size(), neighborhoodFunction.size());
+	EXPECT_EQ(n, estimatedFunction[0]);
+	for (index h = 1; h < estimatedFunction.size(); ++h) {
+		EXPECT_LE(estimatedFunction[h - 1], estimatedFunction[h]);
+		EXPECT_NEAR(neighborhoodFunction[h], estimatedFunction[h], 0.05 * neighborhoodFunction[h]);
+	}
+
+	// the radius limit cuts the neighborhood function
+	HyperBall limited(G, 10, 2);
+	limited.run();
+	EXPECT_EQ(3u, limited.getNeighborhoodFunction().size());
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
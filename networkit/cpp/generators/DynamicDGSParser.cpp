@@ -155,6 +155,7 @@ void DynamicDGSParser::evaluateClusterings(const std::string path, const Partiti
 
 	//Vector of cluster sizes
 	std::vector<index> clusterSizes;
+	Partition::MemberIndex clusterMembers = clustering.getMemberIndex();
 
 	// Iterating through nodes and clusters to which they belong
 	clustering.forEntries([&](node v, index c){
@@ -165,7 +166,7 @@ void DynamicDGSParser::evaluateClusterings(const std::string path, const Partiti
 		// If not, assigning it one
 		if ( gotClusterID == clusterIDMap.end() ) {
 			clusterIDMap[c] = clusterIDCounter;
-			clusterSizes.push_back(clustering.getMembers(c).size());
+			clusterSizes.push_back(clusterMembers.size(c));
 			clusterIDCounter++;
 		}
 
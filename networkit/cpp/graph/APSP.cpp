@@ -8,19 +8,31 @@
 #include "APSP.h"
 #include "../auxiliary/Log.h"
 #include "Dijkstra.h"
+#include "MultiSourceBFS.h"
 
 namespace NetworKit {
 
 APSP::APSP(const Graph& G) : Algorithm(), G(G) {}
 
 void APSP::run() {
-	std::vector<edgeweight> distanceVector(G.upperNodeIdBound(), 0.0);
-	distances.resize(G.upperNodeIdBound(), distanceVector);
-	G.parallelForNodes([&](node u){
-		Dijkstra dijk(G, u);
-		dijk.run();
-		distances[u] = dijk.getDistances();
-	});
+	if (G.isWeighted()) {
+		std::vector<edgeweight> distanceVector(G.upperNodeIdBound(), 0.0);
+		distances.resize(G.upperNodeIdBound(), distanceVector);
+		G.parallelForNodes([&](node u){
+			Dijkstra dijk(G, u, false, false);
+			dijk.run();
+			distances[u] = dijk.getDistances();
+		});
+	} else {
+		// unweighted: hop distances via multi-source BFS, unreachable nodes keep the Dijkstra convention
+		std::vector<edgeweight> distanceVector(G.upperNodeIdBound(), std::numeric_limits<edgeweight>::max());
+		distances.assign(G.upperNodeIdBound(), distanceVector);
+		std::vector<node> sources = G.nodes();
+		MultiSourceBFS msbfs(G);
+		msbfs.run(sources, [&](index i, node v, count dist) {
+			distances[sources[i]][v] = dist;
+		});
+	}
 	hasRun = true;
 }
 
@@ -0,0 +1,247 @@
+/*
+ * CSRGraph.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include <algorithm>
+
+#include "CSRGraph.h"
+
+namespace NetworKit {
+
+CSRGraph::CSRGraph(const Graph& G) :
+	n(G.numberOfNodes()),
+	m(G.numberOfEdges()),
+	storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+	z(G.upperNodeIdBound()),
+	omega(G.upperEdgeIdBound()),
+	weighted(G.isWeighted()),
+	directed(G.isDirected()),
+	edgesIndexed(G.hasEdgeIds()),
+	exists(G.exists) {
+
+	// copies the adjacency arrays of Graph into CSR arrays, skipping deleted edges (marked with none)
+	auto compress = [&](const std::vector<std::vector<node>>& adj, const std::vector<std::vector<edgeweight>>& adjWeights,
+			const std::vector<std::vector<edgeid>>& adjIds, std::vector<index>& offsets, std::vector<node>& targets,
+			std::vector<edgeweight>& weights, std::vector<edgeid>& ids) {
+		offsets.assign(z + 1, 0);
+		#pragma omp parallel for
+		for (node u = 0; u < z; ++u) {
+			count deg = 0;
+			for (node v : adj[u]) {
+				if (v != none) {
+					++deg;
+				}
+			}
+			offsets[u + 1] = deg;
+		}
+		for (node u = 0; u < z; ++u) {
+			offsets[u + 1] += offsets[u];
+		}
+
+		targets.resize(offsets[z]);
+		if (weighted) {
+			weights.resize(offsets[z]);
+		}
+		if (edgesIndexed) {
+			ids.resize(offsets[z]);
+		}
+
+		#pragma omp parallel for schedule(guided)
+		for (node u = 0; u < z; ++u) {
+			index pos = offsets[u];
+			for (index i = 0; i < adj[u].size(); ++i) {
+				if (adj[u][i] == none) {
+					continue;
+				}
+				targets[pos] = adj[u][i];
+				if (weighted) {
+					weights[pos] = adjWeights[u][i];
+				}
+				if (edgesIndexed) {
+					ids[pos] = adjIds[u][i];
+				}
+				++pos;
+			}
+		}
+	};
+
+	compress(G.outEdges, G.outEdgeWeights, G.outEdgeIds, outOffsetData, outTargetData, outWeightData, outIdData);
+	if (directed) {
+		compress(G.inEdges, G.inEdgeWeights, G.inEdgeIds, inOffsetData, inTargetData, inWeightData, inIdData);
+	}
+
+	setViews();
+}
+
+CSRGraph::CSRGraph(count z, count m, count selfLoops, edgeid omega, bool weighted, bool directed, std::vector<bool> exists,
+		const index* outOffsets, const node* outTargets, const edgeweight* outWeights, const edgeid* outIds,
+		const index* inOffsets, const node* inTargets, const edgeweight* inWeights, const edgeid* inIds,
+		std::shared_ptr<const void> backing) :
+	n(z),
+	m(m),
+	storedNumberOfSelfLoops(selfLoops),
+	z(z),
+	omega(outIds != nullptr ? omega : 0),
+	weighted(weighted),
+	directed(directed),
+	edgesIndexed(outIds != nullptr),
+	exists(std::move(exists)),
+	backingStore(std::move(backing)),
+	outOffsets(outOffsets),
+	outTargets(outTargets),
+	outWeights(weighted ? outWeights : nullptr),
+	outIds(outIds),
+	inOffsets(directed ? inOffsets : outOffsets),
+	inTargets(directed ? inTargets : outTargets),
+	inWeights(directed ? (weighted ? inWeights : nullptr) : this->outWeights),
+	inIds(directed ? inIds : outIds) {
+
+	if (this->exists.empty()) {
+		this->exists.assign(z, true);
+	} else {
+		n = std::count(this->exists.begin(), this->exists.end(), true);
+	}
+
+	if (directed && (inOffsets == nullptr || inTargets == nullptr)) {
+		throw std::runtime_error("directed CSR graphs need incoming adjacency arrays");
+	}
+	if (weighted && outWeights == nullptr) {
+		throw std::runtime_error("weighted CSR graphs need weight arrays");
+	}
+}
+
+void CSRGraph::setViews() {
+	outOffsets = outOffsetData.data();
+	outTargets = outTargetData.data();
+	outWeights = weighted ? outWeightData.data() : nullptr;
+	outIds = edgesIndexed ? outIdData.data() : nullptr;
+	if (directed) {
+		inOffsets = inOffsetData.data();
+		inTargets = inTargetData.data();
+		inWeights = weighted ? inWeightData.data() : nullptr;
+		inIds = edgesIndexed ? inIdData.data() : nullptr;
+	} else {
+		inOffsets = outOffsets;
+		inTargets = outTargets;
+		inWeights = outWeights;
+		inIds = outIds;
+	}
+}
+
+Graph CSRGraph::toGraph() const {
+	Graph G(z, weighted, directed);
+	for (node u = 0; u < z; ++u) {
+		if (!exists[u]) {
+			G.removeNode(u);
+		}
+	}
+
+	auto expand = [&](const index* offsets, const node* targets, const edgeweight* weights, const edgeid* ids,
+			std::vector<std::vector<node>>& adj, std::vector<std::vector<edgeweight>>& adjWeights,
+			std::vector<std::vector<edgeid>>& adjIds, std::vector<count>& deg) {
+		if (edgesIndexed) {
+			adjIds.resize(z);
+		}
+		#pragma omp parallel for schedule(guided)
+		for (node u = 0; u < z; ++u) {
+			adj[u].assign(targets + offsets[u], targets + offsets[u + 1]);
+			if (weighted) {
+				adjWeights[u].assign(weights + offsets[u], weights + offsets[u + 1]);
+			}
+			if (edgesIndexed) {
+				adjIds[u].assign(ids + offsets[u], ids + offsets[u + 1]);
+			}
+			deg[u] = offsets[u + 1] - offsets[u];
+		}
+	};
+
+	expand(outOffsets, outTargets, outWeights, outIds, G.outEdges, G.outEdgeWeights, G.outEdgeIds, G.outDeg);
+	if (directed) {
+		expand(inOffsets, inTargets, inWeights, inIds, G.inEdges, G.inEdgeWeights, G.inEdgeIds, G.inDeg);
+	}
+
+	G.m = m;
+	G.storedNumberOfSelfLoops = storedNumberOfSelfLoops;
+	G.edgesIndexed = edgesIndexed;
+	G.omega = omega;
+	return G;
+}
+
+count CSRGraph::memoryUsage() const {
+	count arcs = outOffsets[z];
+	count bytes = (z + 1) * sizeof(index) + arcs * sizeof(node);
+	if (weighted) {
+		bytes += arcs * sizeof(edgeweight);
+	}
+	if (edgesIndexed) {
+		bytes += arcs * sizeof(edgeid);
+	}
+	if (directed) {
+		bytes *= 2;
+	}
+	return bytes;
+}
+
+edgeweight CSRGraph::weightedDegree(node v) const {
+	if (weighted) {
+		edgeweight sum = 0.0;
+		for (index i = outOffsets[v]; i < outOffsets[v + 1]; ++i) {
+			sum += outWeights[i];
+		}
+		return sum;
+	}
+	return defaultEdgeWeight * degree(v);
+}
+
+edgeweight CSRGraph::volume(node v) const {
+	edgeweight sum = 0.0;
+	for (index i = outOffsets[v]; i < outOffsets[v + 1]; ++i) {
+		edgeweight ew = weighted ? outWeights[i] : defaultEdgeWeight;
+		sum += (outTargets[i] == v) ? 2 * ew : ew;
+	}
+	return sum;
+}
+
+bool CSRGraph::hasEdge(node u, node v) const {
+	const node* begin = outTargets + outOffsets[u];
+	const node* end = outTargets + outOffsets[u + 1];
+	return std::find(begin, end, v) != end;
+}
+
+edgeweight CSRGraph::weight(node u, node v) const {
+	for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+		if (outTargets[i] == v) {
+			return weighted ? outWeights[i] : defaultEdgeWeight;
+		}
+	}
+	return nullWeight;
+}
+
+edgeid CSRGraph::edgeId(node u, node v) const {
+	if (!edgesIndexed) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+	for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+		if (outTargets[i] == v) {
+			return outIds[i];
+		}
+	}
+	throw std::runtime_error("Edge does not exist");
+}
+
+edgeweight CSRGraph::totalEdgeWeight() const {
+	if (weighted) {
+		return parallelSumForEdges([](node, node, edgeweight ew) {
+			return ew;
+		});
+	}
+	return numberOfEdges() * defaultEdgeWeight;
+}
+
+std::vector<node> CSRGraph::neighbors(node u) const {
+	return std::vector<node>(outTargets + outOffsets[u], outTargets + outOffsets[u + 1]);
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,675 @@
+/*
+ * CSRGraph.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef CSRGRAPH_H_
+#define CSRGRAPH_H_
+
+#include <vector>
+#include <stack>
+#include <queue>
+#include <memory>
+
+#include "../Globals.h"
+#include "Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable snapshot of a Graph in compressed sparse row (CSR) format.
+ *
+ * All adjacencies are stored in a few contiguous arrays (offsets, targets and, if present, weights and edge ids)
+ * instead of one vector per node. This saves the per-node vector headers of Graph and turns neighborhood
+ * scans into linear memory accesses. The snapshot offers the same read-only query and iterator interface as
+ * Graph, so algorithms written as templates over the graph type can be instantiated on it.
+ * Changes to the original graph after construction are not reflected in the snapshot.
+ */
+class CSRGraph final {
+
+	friend class NetworkitBinaryReader;
+	friend class NetworkitBinaryWriter;
+
+private:
+	count n; //!< number of nodes
+	count m; //!< number of edges
+	count storedNumberOfSelfLoops; //!< number of self loops
+	node z; //!< upper bound of node ids
+	edgeid omega; //!< upper bound of edge ids
+
+	bool weighted; //!< true if the graph is weighted
+	bool directed; //!< true if the graph is directed
+	bool edgesIndexed; //!< true if edge ids are available
+
+	std::vector<bool> exists; //!< exists[v] is true if node v exists
+
+	// owned storage, empty if the arrays are provided by backingStore
+	std::vector<index> outOffsetData;
+	std::vector<node> outTargetData;
+	std::vector<edgeweight> outWeightData;
+	std::vector<edgeid> outIdData;
+	std::vector<index> inOffsetData;
+	std::vector<node> inTargetData;
+	std::vector<edgeweight> inWeightData;
+	std::vector<edgeid> inIdData;
+
+	std::shared_ptr<const void> backingStore; //!< keeps externally provided arrays alive
+
+	// views on the arrays, the adjacency of u is [offsets[u], offsets[u+1])
+	const index* outOffsets;
+	const node* outTargets;
+	const edgeweight* outWeights; //!< nullptr if unweighted
+	const edgeid* outIds; //!< nullptr if edges are not indexed
+	const index* inOffsets; //!< same as outOffsets for undirected graphs
+	const node* inTargets;
+	const edgeweight* inWeights;
+	const edgeid* inIds;
+
+	void setViews();
+
+	template<bool hasWeights>
+	inline edgeweight getWeight(const edgeweight* weights, index i) const;
+
+	template<bool graphHasEdgeIds>
+	inline edgeid getId(const edgeid* ids, index i) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forOutEdgesOfImpl(node u, L handle) const;
+
+	template<bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forInEdgesOfImpl(node u, L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forEdgeImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void parallelForEdgesImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline double parallelSumForEdgesImpl(L handle) const;
+
+public:
+
+	/**
+	 * Creates a CSR snapshot of @a G. Edge weights and edge ids are taken over if present.
+	 * Deleted nodes keep their ids and have no adjacencies.
+	 *
+	 * @param G The graph.
+	 */
+	explicit CSRGraph(const Graph& G);
+
+	/**
+	 * Creates a CSR graph on top of externally stored arrays without copying them. The arrays must stay valid as long
+	 * as @a backing is alive. Weight and id arrays may be nullptr. For undirected graphs the in-arrays are ignored.
+	 *
+	 * The arrays are not scanned, so nothing is read from them before it is used.
+	 *
+	 * @param z Upper bound of the node ids (the offset arrays have z + 1 entries).
+	 * @param m Number of edges.
+	 * @param selfLoops Number of self loops.
+	 * @param omega Upper bound of the edge ids, ignored if @a outIds is nullptr.
+	 * @param weighted Whether @a outWeights / @a inWeights are given.
+	 * @param directed Whether the graph is directed.
+	 * @param exists Node existence flags; if empty, all nodes exist.
+	 */
+	CSRGraph(count z, count m, count selfLoops, edgeid omega, bool weighted, bool directed, std::vector<bool> exists,
+		const index* outOffsets, const node* outTargets, const edgeweight* outWeights, const edgeid* outIds,
+		const index* inOffsets, const node* inTargets, const edgeweight* inWeights, const edgeid* inIds,
+		std::shared_ptr<const void> backing);
+
+	CSRGraph(const CSRGraph& other) = delete;
+	CSRGraph& operator=(const CSRGraph& other) = delete;
+
+	/** Move constructor, the views stay valid as vector buffers are moved along */
+	CSRGraph(CSRGraph&& other) = default;
+
+	/** Move assignment operator */
+	CSRGraph& operator=(CSRGraph&& other) = default;
+
+	/**
+	 * Creates a Graph with the same nodes, edges, weights and edge ids.
+	 */
+	Graph toGraph() const;
+
+	/** GRAPH INFORMATION **/
+
+	bool isWeighted() const { return weighted; }
+
+	bool isDirected() const { return directed; }
+
+	bool hasEdgeIds() const { return edgesIndexed; }
+
+	bool isEmpty() const { return n == 0; }
+
+	count numberOfNodes() const { return n; }
+
+	count numberOfEdges() const { return m; }
+
+	count numberOfSelfLoops() const { return storedNumberOfSelfLoops; }
+
+	index upperNodeIdBound() const { return z; }
+
+	index upperEdgeIdBound() const { return omega; }
+
+	bool hasNode(node v) const { return (v < z) && exists[v]; }
+
+	/**
+	 * @return The number of bytes occupied by the adjacency arrays.
+	 */
+	count memoryUsage() const;
+
+	/** NODE PROPERTIES **/
+
+	/**
+	 * Returns the number of outgoing neighbors of @a v.
+	 */
+	count degree(node v) const { return outOffsets[v + 1] - outOffsets[v]; }
+
+	count degreeOut(node v) const { return degree(v); }
+
+	/**
+	 * Returns the number of incoming neighbors of @a v (the degree for undirected graphs).
+	 */
+	count degreeIn(node v) const { return inOffsets[v + 1] - inOffsets[v]; }
+
+	bool isIsolated(node v) const { return degree(v) == 0 && degreeIn(v) == 0; }
+
+	/**
+	 * Returns the weighted degree of @a v. For directed graphs only outgoing edges count.
+	 */
+	edgeweight weightedDegree(node v) const;
+
+	/**
+	 * Returns the volume of @a v, which is the weighted degree with self-loops counted twice.
+	 */
+	edgeweight volume(node v) const;
+
+	/** EDGE ATTRIBUTES **/
+
+	/**
+	 * Checks if edge (@a u, @a v) exists. Running time is linear in the degree of @a u.
+	 */
+	bool hasEdge(node u, node v) const;
+
+	/**
+	 * Returns the weight of edge (@a u, @a v) or 0 if it does not exist. Running time is linear in the degree of @a u.
+	 */
+	edgeweight weight(node u, node v) const;
+
+	/**
+	 * Returns the id of edge (@a u, @a v). Edges must be indexed.
+	 */
+	edgeid edgeId(node u, node v) const;
+
+	/**
+	 * Returns the sum of all edge weights.
+	 */
+	edgeweight totalEdgeWeight() const;
+
+	/**
+	 * Get list of neighbors of @a u.
+	 */
+	std::vector<node> neighbors(node u) const;
+
+	/* NODE ITERATORS */
+
+	template<typename L> void forNodes(L handle) const;
+
+	template<typename L> void parallelForNodes(L handle) const;
+
+	template<typename C, typename L> void forNodesWhile(C condition, L handle) const;
+
+	template<typename L> void balancedParallelForNodes(L handle) const;
+
+	template<typename L> void forNodePairs(L handle) const;
+
+	/* EDGE ITERATORS */
+
+	/**
+	 * Iterate over all edges and call @a handle, see Graph::forEdges.
+	 */
+	template<typename L> void forEdges(L handle) const;
+
+	/**
+	 * Iterate in parallel over all edges and call @a handle, see Graph::parallelForEdges.
+	 */
+	template<typename L> void parallelForEdges(L handle) const;
+
+	/* NEIGHBORHOOD ITERATORS */
+
+	/**
+	 * Iterate over all (outgoing) neighbors of @a u, see Graph::forNeighborsOf.
+	 */
+	template<typename L> void forNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forEdgesOf(node u, L handle) const;
+
+	/**
+	 * Iterate over all incoming neighbors of @a u, see Graph::forInNeighborsOf.
+	 */
+	template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forInEdgesOf(node u, L handle) const;
+
+	/**
+	 * Iterate over the incoming neighbors of @a u as long as the condition is met, see Graph::forInNeighborsWhile.
+	 */
+	template<typename C, typename L> void forInNeighborsWhile(node u, C condition, L handle) const;
+
+	/* REDUCTION ITERATORS */
+
+	template<typename L> double parallelSumForNodes(L handle) const;
+
+	template<typename L> double parallelSumForEdges(L handle) const;
+
+	/* GRAPH SEARCHES */
+
+	template<typename L> void BFSfrom(node r, L handle) const;
+
+	template<typename L> void BFSfrom(const std::vector<node> &startNodes, L handle) const;
+
+	/**
+	 * Parallel direction-optimizing breadth-first search, see Graph::parallelBFSfrom.
+	 */
+	template<typename L> void parallelBFSfrom(node r, L handle) const;
+
+	template<typename L> void parallelBFSfrom(const std::vector<node> &startNodes, L handle) const;
+
+	template<typename L> void DFSfrom(node r, L handle) const;
+};
+
+/* NODE ITERATORS */
+
+template<typename L>
+void CSRGraph::forNodes(L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CSRGraph::parallelForNodes(L handle) const {
+	#pragma omp parallel for
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename C, typename L>
+void CSRGraph::forNodesWhile(C condition, L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			if (!condition()) {
+				break;
+			}
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CSRGraph::balancedParallelForNodes(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CSRGraph::forNodePairs(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		if (exists[u]) {
+			for (node v = u + 1; v < z; ++v) {
+				if (exists[v]) {
+					handle(u, v);
+				}
+			}
+		}
+	}
+}
+
+/* HELPERS */
+
+template<bool hasWeights> // implementation for weighted == true
+inline edgeweight CSRGraph::getWeight(const edgeweight* weights, index i) const {
+	return weights[i];
+}
+
+template<> // implementation for weighted == false
+inline edgeweight CSRGraph::getWeight<false>(const edgeweight*, index) const {
+	return defaultEdgeWeight;
+}
+
+template<bool graphHasEdgeIds> // implementation for hasEdgeIds == true
+inline edgeid CSRGraph::getId(const edgeid* ids, index i) const {
+	return ids[i];
+}
+
+template<> // implementation for hasEdgeIds == false
+inline edgeid CSRGraph::getId<false>(const edgeid*, index) const {
+	return 0;
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forOutEdgesOfImpl(node u, L handle) const {
+	const index end = outOffsets[u + 1];
+	for (index i = outOffsets[u]; i < end; ++i) {
+		node v = outTargets[i];
+		// undirected edges are only reported once, from the larger endpoint (same as Graph)
+		if (graphIsDirected || u >= v) {
+			Graph::edgeLambda<L>(handle, u, v, getWeight<hasWeights>(outWeights, i), getId<graphHasEdgeIds>(outIds, i));
+		}
+	}
+}
+
+template<bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forInEdgesOfImpl(node u, L handle) const {
+	const index end = inOffsets[u + 1];
+	for (index i = inOffsets[u]; i < end; ++i) {
+		Graph::edgeLambda<L>(handle, u, inTargets[i], getWeight<hasWeights>(inWeights, i), getId<graphHasEdgeIds>(inIds, i));
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forEdgeImpl(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::parallelForEdgesImpl(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline double CSRGraph::parallelSumForEdgesImpl(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum) schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		const index end = outOffsets[u + 1];
+		for (index i = outOffsets[u]; i < end; ++i) {
+			node v = outTargets[i];
+			if (graphIsDirected || u >= v) {
+				sum += Graph::edgeLambda<L>(handle, u, v, getWeight<hasWeights>(outWeights, i), getId<graphHasEdgeIds>(outIds, i));
+			}
+		}
+	}
+	return sum;
+}
+
+template<typename L>
+void CSRGraph::forEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edgeIds
+		forEdgeImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edgeIds
+		forEdgeImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edgeIds
+		forEdgeImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted, directed, no edgeIds
+		forEdgeImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edgeIds
+		forEdgeImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edgeIds
+		forEdgeImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edgeIds
+		forEdgeImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edgeIds
+		forEdgeImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+template<typename L>
+void CSRGraph::parallelForEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edgeIds
+		parallelForEdgesImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edgeIds
+		parallelForEdgesImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edgeIds
+		parallelForEdgesImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted, directed, no edgeIds
+		parallelForEdgesImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edgeIds
+		parallelForEdgesImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edgeIds
+		parallelForEdgesImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edgeIds
+		parallelForEdgesImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edgeIds
+		parallelForEdgesImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template<typename L>
+void CSRGraph::forNeighborsOf(node u, L handle) const {
+	forEdgesOf(u, handle);
+}
+
+template<typename L>
+void CSRGraph::forEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * edgesIndexed) {
+	case 0: //not weighted, no edge ids
+		forOutEdgesOfImpl<true, false, false, L>(u, handle);
+		break;
+
+	case 1:	//weighted, no edge ids
+		forOutEdgesOfImpl<true, true, false, L>(u, handle);
+		break;
+
+	case 2: //not weighted, with edge ids
+		forOutEdgesOfImpl<true, false, true, L>(u, handle);
+		break;
+
+	case 3:	//weighted, with edge ids
+		forOutEdgesOfImpl<true, true, true, L>(u, handle);
+		break;
+	}
+}
+
+template<typename L>
+void CSRGraph::forInNeighborsOf(node u, L handle) const {
+	forInEdgesOf(u, handle);
+}
+
+template<typename C, typename L>
+void CSRGraph::forInNeighborsWhile(node u, C condition, L handle) const {
+	const index end = inOffsets[u + 1];
+	for (index i = inOffsets[u]; i < end; ++i) {
+		if (!condition()) {
+			break;
+		}
+		handle(inTargets[i]);
+	}
+}
+
+template<typename L>
+void CSRGraph::forInEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * edgesIndexed) {
+	case 0: //not weighted, no edge ids
+		forInEdgesOfImpl<false, false, L>(u, handle);
+		break;
+
+	case 1:	//weighted, no edge ids
+		forInEdgesOfImpl<true, false, L>(u, handle);
+		break;
+
+	case 2: //not weighted, with edge ids
+		forInEdgesOfImpl<false, true, L>(u, handle);
+		break;
+
+	case 3:	//weighted, with edge ids
+		forInEdgesOfImpl<true, true, L>(u, handle);
+		break;
+	}
+}
+
+/* REDUCTION ITERATORS */
+
+template<typename L>
+double CSRGraph::parallelSumForNodes(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			sum += handle(v);
+		}
+	}
+	return sum;
+}
+
+template<typename L>
+double CSRGraph::parallelSumForEdges(L handle) const {
+	double sum = 0.0;
+
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edge ids
+		sum = parallelSumForEdgesImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edge ids
+		sum = parallelSumForEdgesImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edge ids
+		sum = parallelSumForEdgesImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted,   directed, no edge ids
+		sum = parallelSumForEdgesImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edge ids
+		sum = parallelSumForEdgesImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edge ids
+		sum = parallelSumForEdgesImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edge ids
+		sum = parallelSumForEdgesImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edge ids
+		sum = parallelSumForEdgesImpl<true, true, true, L>(handle);
+		break;
+	}
+
+	return sum;
+}
+
+/* GRAPH SEARCHES */
+
+template<typename L>
+void CSRGraph::BFSfrom(node r, L handle) const {
+	std::vector<node> startNodes(1, r);
+	BFSfrom(startNodes, handle);
+}
+
+template<typename L>
+void CSRGraph::BFSfrom(const std::vector<node> &startNodes, L handle) const {
+	std::vector<bool> marked(z);
+	std::vector<node> current, next;
+	count dist = 0;
+	for (node u : startNodes) {
+		current.push_back(u);
+		marked[u] = true;
+	}
+	while (!current.empty()) {
+		for (node u : current) {
+			Graph::callBFSHandle(handle, u, dist);
+			const index end = outOffsets[u + 1];
+			for (index i = outOffsets[u]; i < end; ++i) {
+				node v = outTargets[i];
+				if (!marked[v]) {
+					next.push_back(v);
+					marked[v] = true;
+				}
+			}
+		}
+		current.swap(next);
+		next.clear();
+		++dist;
+	}
+}
+
+template<typename L>
+void CSRGraph::parallelBFSfrom(node r, L handle) const {
+	std::vector<node> startNodes(1, r);
+	parallelBFSfrom(startNodes, handle);
+}
+
+template<typename L>
+void CSRGraph::parallelBFSfrom(const std::vector<node> &startNodes, L handle) const {
+	parallelBFS(*this, startNodes, handle);
+}
+
+template<typename L>
+void CSRGraph::DFSfrom(node r, L handle) const {
+	std::vector<bool> marked(z);
+	std::stack<node> s;
+	s.push(r);
+	marked[r] = true;
+	do {
+		node u = s.top();
+		s.pop();
+		handle(u);
+		const index end = outOffsets[u + 1];
+		for (index i = outOffsets[u]; i < end; ++i) {
+			node v = outTargets[i];
+			if (!marked[v]) {
+				s.push(v);
+				marked[v] = true;
+			}
+		}
+	} while (!s.empty());
+}
+
+} /* namespace NetworKit */
+
+#endif /* CSRGRAPH_H_ */
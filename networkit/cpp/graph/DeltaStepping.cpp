@@ -0,0 +1,176 @@
+/*
+ * DeltaStepping.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "DeltaStepping.h"
+#include "../auxiliary/Parallel.h"
+
+#include <omp.h>
+#include <sstream>
+#include <limits>
+#include <stdexcept>
+
+namespace NetworKit {
+
+DeltaStepping::DeltaStepping(const Graph& G, node source, bool storePaths, bool storeStack, edgeweight delta) : SSSP(G, source, storePaths, storeStack), delta(delta), maxWeight(G.numberOfEdges() > 0 ? defaultEdgeWeight : 0.0) {
+	if (G.isWeighted()) {
+		count invalid = 0;
+		edgeweight maxW = 0.0;
+		const count z = G.upperNodeIdBound();
+		#pragma omp parallel for schedule(guided) reduction(+:invalid) reduction(max:maxW)
+		for (node u = 0; u < z; ++u) {
+			G.forEdgesOf(u, [&](node, node, edgeweight w) {
+				if (!(w > 0.0)) {
+					++invalid;
+				} else if (w > maxW) {
+					maxW = w;
+				}
+			});
+		}
+		if (invalid > 0) {
+			throw std::runtime_error("DeltaStepping requires strictly positive edge weights");
+		}
+		maxWeight = maxW;
+	}
+	if (this->delta <= 0.0) {
+		this->delta = (G.numberOfEdges() > 0) ? G.totalEdgeWeight() / G.numberOfEdges() : 1.0;
+		if (this->delta <= 0.0) {
+			this->delta = 1.0;
+		}
+	}
+}
+
+void DeltaStepping::run() {
+	const count z = G.upperNodeIdBound();
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	distances.clear();
+	distances.resize(z, infDist);
+	distances[source] = 0;
+
+	// lowers distances[v] to d if d is smaller, returns true if it did
+	auto atomicMin = [&](node v, edgeweight d) {
+		edgeweight old = distances[v];
+		while (d < old) {
+			if (__atomic_compare_exchange(&distances[v], &old, &d, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// all pending distances lie below the current bucket plus the maximum edge weight, so the buckets can be
+	// kept in a cyclic array whose size depends on maxWeight / delta only and not on the largest distance
+	const count numBuckets = static_cast<count>(maxWeight / delta) + 2;
+	const index noBucket = std::numeric_limits<index>::max();
+	std::vector<node> frontier {source};
+	index currentBucket = 0;
+	index nextBucket = 0;
+
+	#pragma omp parallel
+	{
+		std::vector<std::vector<node>> localBuckets(numBuckets);
+
+		while (!frontier.empty()) {
+			#pragma omp for schedule(dynamic, 64) nowait
+			for (index i = 0; i < frontier.size(); ++i) {
+				node u = frontier[i];
+				edgeweight du = distances[u];
+				// skip stale entries, u has already been settled from a lower bucket
+				if (static_cast<index>(du / delta) < currentBucket) {
+					continue;
+				}
+				G.forEdgesOf(u, [&](node, node v, edgeweight w) {
+					edgeweight dv = du + w;
+					if (atomicMin(v, dv)) {
+						localBuckets[static_cast<index>(dv / delta) % numBuckets].push_back(v);
+					}
+				});
+			}
+
+			// find the lowest non-empty bucket over all threads
+			#pragma omp single
+			nextBucket = noBucket;
+			for (index b = currentBucket; b < currentBucket + numBuckets; ++b) {
+				if (!localBuckets[b % numBuckets].empty()) {
+					#pragma omp critical
+					nextBucket = std::min(nextBucket, b);
+					break;
+				}
+			}
+			#pragma omp barrier
+
+			#pragma omp single
+			{
+				frontier.clear();
+				currentBucket = nextBucket;
+			}
+			if (nextBucket != noBucket && !localBuckets[nextBucket % numBuckets].empty()) {
+				std::vector<node>& bucket = localBuckets[nextBucket % numBuckets];
+				#pragma omp critical
+				frontier.insert(frontier.end(), bucket.begin(), bucket.end());
+				bucket.clear();
+			}
+			#pragma omp barrier
+		}
+	}
+
+	if (!storePaths && !storeStack) {
+		hasRun = true;
+		return;
+	}
+
+	// all reached nodes ordered by distance, ties are broken by id. Since all edge weights are positive, nodes of
+	// equal distance are never predecessors of each other, so this is a valid order for the path counts and the stack
+	std::vector<node> reached;
+	G.forNodes([&](node v) {
+		if (distances[v] != infDist) {
+			reached.push_back(v);
+		}
+	});
+	Aux::Parallel::sort(reached.begin(), reached.end(), [&](node u, node v) {
+		return distances[u] < distances[v] || (distances[u] == distances[v] && u < v);
+	});
+
+	if (storePaths) {
+		previous.clear();
+		previous.resize(z);
+		npaths.clear();
+		npaths.resize(z, 0);
+		npaths[source] = 1;
+
+		#pragma omp parallel for schedule(guided)
+		for (index i = 0; i < reached.size(); ++i) {
+			node v = reached[i];
+			if (v == source) {
+				continue;
+			}
+			G.forInEdgesOf(v, [&](node, node u, edgeweight w) {
+				if (u != v && distances[u] != infDist && distances[u] + w == distances[v]) {
+					previous[v].push_back(u);
+				}
+			});
+		}
+
+		for (node v : reached) {
+			for (node u : previous[v]) {
+				npaths[v] += npaths[u];
+			}
+		}
+	}
+
+	if (storeStack) {
+		stack = std::move(reached);
+	}
+
+	hasRun = true;
+}
+
+std::string DeltaStepping::toString() const {
+	std::stringstream stream;
+	stream << "DeltaStepping(delta=" << delta << ")";
+	return stream.str();
+}
+
+} /* namespace NetworKit */
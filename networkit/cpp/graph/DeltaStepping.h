@@ -0,0 +1,72 @@
+/*
+ * DeltaStepping.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef DELTASTEPPING_H_
+#define DELTASTEPPING_H_
+
+#include "Graph.h"
+#include "SSSP.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Parallel delta-stepping SSSP algorithm for graphs with positive edge weights.
+ *
+ * Nodes are kept in buckets of width delta. All nodes of the lowest non-empty bucket are settled in parallel,
+ * tentative distances are lowered with an atomic compare-and-swap and every thread collects the improved nodes
+ * in its own buckets. See Meyer and Sanders, "Delta-stepping: a parallelizable shortest path algorithm",
+ * J. Algorithms 49 (2003).
+ *
+ * Predecessors, the number of shortest paths and the stack are derived from the final distances in a second
+ * pass, so the results can be used in place of those of Dijkstra. The search always covers the whole
+ * component of the source, a target node is not supported.
+ */
+class DeltaStepping : public SSSP {
+
+public:
+
+	/**
+	 * Creates the DeltaStepping class for @a G and the source node @a source.
+	 *
+	 * @param G The graph.
+	 * @param source The source node.
+	 * @param storePaths	store paths and number of paths?
+	 * @param storeStack	store a stack of nodes ordered by distance?
+	 * @param delta The bucket width. If not positive, the average edge weight is used.
+	 * Every thread keeps (maximum edge weight / delta) + 2 buckets, which are reused cyclically.
+	 *
+	 * Throws a std::runtime_error if @a G has an edge with a weight that is not strictly positive, since the
+	 * shortest path counts and the stack are derived by ordering nodes by distance, which requires that a
+	 * predecessor is always strictly closer to the source than its successor.
+	 */
+	DeltaStepping(const Graph& G, node source, bool storePaths=true, bool storeStack=false, edgeweight delta = 0.0);
+
+	/**
+	 * Performs the delta-stepping SSSP algorithm on the graph given in the constructor.
+	 */
+	virtual void run();
+
+	virtual bool isParallel() const { return true; }
+
+	virtual std::string toString() const;
+
+	/**
+	 * @return The bucket width used by the algorithm.
+	 */
+	edgeweight getDelta() const;
+
+private:
+	edgeweight delta;
+	edgeweight maxWeight; //!< largest edge weight, bounds the range of pending buckets
+};
+
+inline edgeweight DeltaStepping::getDelta() const {
+	return delta;
+}
+
+} /* namespace NetworKit */
+#endif /* DELTASTEPPING_H_ */
@@ -0,0 +1,54 @@
+/*
+ * DirOptBFS.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include <algorithm>
+
+#include "DirOptBFS.h"
+
+namespace NetworKit {
+
+DirOptBFS::DirOptBFS(const Graph& G, node source, bool storeStack) : SSSP(G, source, false, storeStack) {
+}
+
+void DirOptBFS::run() {
+	edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	count z = G.upperNodeIdBound();
+	distances.clear();
+	distances.resize(z, infDist);
+
+	G.parallelBFSfrom(source, [&](node u, count dist) {
+		distances[u] = dist;
+	});
+
+	if (storeStack) {
+		// counting sort of the reached nodes by distance
+		count maxDist = 0;
+		G.forNodes([&](node u) {
+			if (distances[u] != infDist) {
+				maxDist = std::max(maxDist, static_cast<count>(distances[u]));
+			}
+		});
+		std::vector<index> levelBegin(maxDist + 2, 0);
+		G.forNodes([&](node u) {
+			if (distances[u] != infDist) {
+				++levelBegin[static_cast<index>(distances[u]) + 1];
+			}
+		});
+		for (index d = 1; d < levelBegin.size(); ++d) {
+			levelBegin[d] += levelBegin[d - 1];
+		}
+		stack.assign(levelBegin.back(), none);
+		G.forNodes([&](node u) {
+			if (distances[u] != infDist) {
+				stack[levelBegin[static_cast<index>(distances[u])]++] = u;
+			}
+		});
+	}
+
+	hasRun = true;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,47 @@
+/*
+ * DirOptBFS.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef DIROPTBFS_H_
+#define DIROPTBFS_H_
+
+#include "Graph.h"
+#include "SSSP.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Parallel direction-optimizing breadth-first search. Levels are expanded top-down from the frontier while it is
+ * small and bottom-up from the unvisited nodes while it touches a large share of the remaining edges, which pays
+ * off on low-diameter graphs. See Graph::parallelBFSfrom.
+ *
+ * Only distances and the stack are computed, shortest paths and path counts are not supported.
+ */
+class DirOptBFS : public SSSP {
+
+public:
+	/**
+	 * Constructs the DirOptBFS class for @a G and source node @a source.
+	 *
+	 * @param G The graph.
+	 * @param source The source node of the breadth-first search.
+	 * @param storeStack	maintain a stack of nodes in decreasing order of distance
+	 */
+	DirOptBFS(const Graph& G, node source, bool storeStack=false);
+
+	/**
+	 * Breadth-first search from @a source.
+	 */
+	virtual void run();
+
+	/**
+	 * @return True if algorithm can run multi-threaded.
+	 */
+	virtual bool isParallel() const { return true; }
+};
+
+} /* namespace NetworKit */
+#endif /* DIROPTBFS_H_ */
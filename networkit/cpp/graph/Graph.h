@@ -25,6 +25,9 @@
 
 namespace NetworKit {
 
+template<class GraphType, typename L>
+void parallelBFS(const GraphType& G, const std::vector<node>& startNodes, L handle);
+
 /**
  * @ingroup graph
  * A graph (with optional weights) and parallel iterator methods.
@@ -33,6 +36,8 @@ class Graph final {
 
 	friend class ParallelPartitionCoarsening;
 	friend class GraphBuilder;
+	friend class CSRGraph;
+	template<class GraphType, typename L> friend void parallelBFS(const GraphType& G, const std::vector<node>& startNodes, L handle);
 
 private:
 	// graph attributes
@@ -200,7 +205,7 @@ private:
 	 * error messages from the other declarations.
 	 */
 	template<class F, void* = (void*)0>
-	typename Aux::FunctionTraits<F>::result_type edgeLambda(F&f, ...) const {
+	static typename Aux::FunctionTraits<F>::result_type edgeLambda(F&f, ...) {
 		// the strange condition is used in order to delay the eveluation of the static assert to the moment when this function is actually used
 		static_assert(! std::is_same<F, F>::value, "Your lambda does not support the required parameters or the parameters have the wrong type.");
 		return std::declval<typename Aux::FunctionTraits<F>::result_type>(); // use the correct return type (this won't compile)
@@ -216,7 +221,7 @@ private:
 	         std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
 	         std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::value
 	         >::type * = (void*)0 >
-	auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew, id)) {
+	static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) -> decltype(f(u, v, ew, id)) {
 		return f(u, v, ew, id);
 	}
 
@@ -231,7 +236,7 @@ private:
 			 std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
 			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value /* prevent f(v, weight, eid) */
 			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, id)) {
+	static auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) -> decltype(f(u, v, id)) {
 		return f(u, v, id);
 	}
 
@@ -244,7 +249,7 @@ private:
 			 (Aux::FunctionTraits<F>::arity >= 2) &&
 			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
 			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew)) {
+	static auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) -> decltype(f(u, v, ew)) {
 		return f(u, v, ew);
 	}
 
@@ -259,7 +264,7 @@ private:
 			 (Aux::FunctionTraits<F>::arity >= 1) &&
 			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
 			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v)) {
+	static auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) -> decltype(f(u, v)) {
 			return f(u, v);
 	}
 
@@ -273,7 +278,7 @@ private:
 			 (Aux::FunctionTraits<F>::arity >= 1) &&
 			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
 			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, ew)) {
+	static auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) -> decltype(f(u, ew)) {
 		return f(v, ew);
 	}
 
@@ -284,7 +289,7 @@ private:
 	 */
 	template<class F,
 			 void* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(v)) {
+	static auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) -> decltype(f(v)) {
 		return f(v);
 	}
 
@@ -293,7 +298,7 @@ private:
 	 * Calls the given BFS handle with distance parameter
 	 */
 	template <class F>
-	auto callBFSHandle(F &f, node u, count dist) const -> decltype(f(u, dist)) {
+	static auto callBFSHandle(F &f, node u, count dist) -> decltype(f(u, dist)) {
 		return f(u, dist);
 	}
 
@@ -301,7 +306,7 @@ private:
 	 * Calls the given BFS handle without distance parameter
 	 */
 	template <class F>
-	auto callBFSHandle(F &f, node u, count dist) const -> decltype(f(u)) {
+	static auto callBFSHandle(F &f, node u, count dist) -> decltype(f(u)) {
 		return f(u);
 	}
 
@@ -942,6 +947,14 @@ public:
 	 */
 	template<typename L> void forInNeighborsOf(node u, L handle) const;
 
+	/**
+	 * Iterate over the incoming neighbors of a node as long as the condition is met.
+	 *
+	 * @param condition Returning <code>false</code> breaks the loop.
+	 * @param handle Takes parameter <code>(node)</code>.
+	 */
+	template<typename C, typename L> void forInNeighborsWhile(node u, C condition, L handle) const;
+
 	/**
 	 * Iterate over all incoming edges of a node and call handler (lamdba closure).
 	 * @note For undirected graphs all edges incident to u are also incoming edges.
@@ -977,6 +990,19 @@ public:
 
 	template<typename L> void BFSEdgesFrom(node r, L handle) const;
 
+	/**
+	 * Parallel direction-optimizing breadth-first search starting from r. Each level is expanded either top-down
+	 * from the frontier or, once the frontier touches a large share of the unexplored edges, bottom-up from the
+	 * unvisited nodes (Beamer et al., "Direction-Optimizing Breadth-First Search", SC 2012).
+	 *
+	 * @param r Node.
+	 * @param handle Takes parameter <code>(node)</code> or <code>(node, count)</code> where the second parameter is the
+	 * distance to the closest start node. It is called exactly once per reached node, but concurrently for the nodes of
+	 * one level, so it must be thread-safe. All calls for a level finish before the calls of the next level start.
+	 */
+	template<typename L> void parallelBFSfrom(node r, L handle) const;
+	template<typename L> void parallelBFSfrom(const std::vector<node> &startNodes, L handle) const;
+
 	/**
 	 * Iterate over nodes in depth-first search order starting from r until connected component
 	 * of r has been visited.
@@ -1304,6 +1330,18 @@ void Graph::forInNeighborsOf(node u, L handle) const {
 	forInEdgesOf(u, handle);
 }
 
+template<typename C, typename L>
+void Graph::forInNeighborsWhile(node u, C condition, L handle) const {
+	for (node v : directed ? inEdges[u] : outEdges[u]) {
+		if (v != none) {
+			if (!condition()) {
+				break;
+			}
+			handle(v);
+		}
+	}
+}
+
 template<typename L>
 void Graph::forInEdgesOf(node u, L handle) const {
 	switch (weighted + 2 * directed + 4 * edgesIndexed) {
@@ -1435,6 +1473,17 @@ void Graph::BFSfrom(const std::vector<node> &startNodes, L handle) const {
 	} while (!q.empty());
 }
 
+template<typename L>
+void Graph::parallelBFSfrom(node r, L handle) const {
+	std::vector<node> startNodes(1, r);
+	parallelBFSfrom(startNodes, handle);
+}
+
+template<typename L>
+void Graph::parallelBFSfrom(const std::vector<node> &startNodes, L handle) const {
+	parallelBFS(*this, startNodes, handle);
+}
+
 template<typename L>
 void Graph::BFSEdgesFrom(node r, L handle) const {
 	std::vector<bool> marked(z);
@@ -1495,6 +1544,118 @@ void Graph::DFSEdgesFrom(node r, L handle) const {
 	} while (!s.empty());
 }
 
+/**
+ * Parallel direction-optimizing breadth-first search on @a G from @a startNodes, see Graph::parallelBFSfrom.
+ * Shared by Graph and CSRGraph, @a GraphType has to provide their node and neighborhood queries.
+ */
+template<class GraphType, typename L>
+void parallelBFS(const GraphType& G, const std::vector<node>& startNodes, L handle) {
+	// switching thresholds suggested by Beamer et al.
+	const double alpha = 14.0;
+	const double beta = 24.0;
+
+	const count z = G.upperNodeIdBound();
+	const count words = (z + 63) / 64;
+	std::vector<uint64_t> visited(words, 0);
+	std::vector<uint64_t> inFrontier;
+	auto isSet = [](const std::vector<uint64_t>& bits, node v) {
+		return (bits[v / 64] >> (v % 64)) & 1;
+	};
+	// returns true if v has not been visited before
+	auto testAndSet = [](std::vector<uint64_t>& bits, node v) {
+		uint64_t bit = uint64_t(1) << (v % 64);
+		if (bits[v / 64] & bit) {
+			return false;
+		}
+		return !(__sync_fetch_and_or(&bits[v / 64], bit) & bit);
+	};
+
+	std::vector<node> frontier;
+	for (node u : startNodes) {
+		if (testAndSet(visited, u)) {
+			frontier.push_back(u);
+		}
+	}
+
+	// number of arcs a bottom-up step still has to consider
+	count unexploredArcs = 0;
+	#pragma omp parallel for reduction(+:unexploredArcs)
+	for (node v = 0; v < z; ++v) {
+		if (G.hasNode(v)) {
+			unexploredArcs += G.degreeIn(v);
+		}
+	}
+
+	std::vector<node> next;
+	bool bottomUp = false;
+	count dist = 0;
+	while (!frontier.empty()) {
+		count frontierArcs = 0;
+		count frontierInArcs = 0;
+		#pragma omp parallel for reduction(+:frontierArcs,frontierInArcs)
+		for (index i = 0; i < frontier.size(); ++i) {
+			Graph::callBFSHandle(handle, frontier[i], dist);
+			frontierArcs += G.degree(frontier[i]);
+			frontierInArcs += G.degreeIn(frontier[i]);
+		}
+		unexploredArcs -= frontierInArcs;
+
+		if (!bottomUp && frontierArcs > unexploredArcs / alpha) {
+			bottomUp = true;
+		} else if (bottomUp && frontier.size() < G.numberOfNodes() / beta) {
+			bottomUp = false;
+		}
+
+		next.clear();
+		if (bottomUp) {
+			inFrontier.assign(words, 0);
+			#pragma omp parallel for
+			for (index i = 0; i < frontier.size(); ++i) {
+				testAndSet(inFrontier, frontier[i]);
+			}
+
+			#pragma omp parallel
+			{
+				std::vector<node> localNext;
+				#pragma omp for schedule(guided) nowait
+				for (node v = 0; v < z; ++v) {
+					if (!G.hasNode(v) || isSet(visited, v)) {
+						continue;
+					}
+					bool found = false;
+					G.forInNeighborsWhile(v, [&]() { return !found; }, [&](node u) {
+						found = isSet(inFrontier, u);
+					});
+					if (found) {
+						testAndSet(visited, v);
+						localNext.push_back(v);
+					}
+				}
+				#pragma omp critical
+				next.insert(next.end(), localNext.begin(), localNext.end());
+			}
+		} else {
+			#pragma omp parallel
+			{
+				std::vector<node> localNext;
+				#pragma omp for schedule(guided) nowait
+				for (index i = 0; i < frontier.size(); ++i) {
+					G.forNeighborsOf(frontier[i], [&](node v) {
+						if (testAndSet(visited, v)) {
+							localNext.push_back(v);
+						}
+					});
+				}
+				#pragma omp critical
+				next.insert(next.end(), localNext.begin(), localNext.end());
+			}
+		}
+
+		frontier.swap(next);
+		++dist;
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /* GRAPH_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include <stdexcept>
+#include <algorithm>
 #include <omp.h>
 
 #include "GraphBuilder.h"
@@ -384,6 +385,135 @@ void GraphBuilder::toGraphSequential(Graph &G) {
 	G.storedNumberOfSelfLoops = numberOfSelfLoops;
 }
 
+/**
+ * Sorts the items 0, ..., items - 1 by key(i) < buckets, items with key none are dropped. Afterwards the items
+ * with key b are sorted[offsets[b]], ..., sorted[offsets[b+1] - 1], in increasing order.
+ */
+template <typename K>
+void GraphBuilder::stableCountingSort(count items, count buckets, K key, std::vector<index>& offsets, std::vector<index>& sorted) {
+	// one shared histogram, so the extra memory is O(buckets) independent of the number of threads
+	offsets.assign(buckets + 1, 0);
+	#pragma omp parallel for
+	for (index i = 0; i < items; ++i) {
+		node b = key(i);
+		if (b != none) {
+			#pragma omp atomic
+			offsets[b + 1]++;
+		}
+	}
+	for (index b = 0; b < buckets; ++b) {
+		offsets[b + 1] += offsets[b];
+	}
+
+	sorted.resize(offsets[buckets]);
+	std::vector<index> next(offsets.begin(), offsets.end() - 1);
+	#pragma omp parallel for
+	for (index i = 0; i < items; ++i) {
+		node b = key(i);
+		if (b != none) {
+			index pos;
+			#pragma omp atomic capture
+			pos = next[b]++;
+			sorted[pos] = i;
+		}
+	}
+	next.clear();
+	next.shrink_to_fit();
+
+	// the scatter is unordered within a bucket, sorting the item ids restores the input order
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (index b = 0; b < buckets; ++b) {
+		std::sort(sorted.begin() + offsets[b], sorted.begin() + offsets[b + 1]);
+	}
+}
+
+void GraphBuilder::addEdges(const std::vector<std::pair<node, node>>& edges, const std::vector<edgeweight>& weights,
+		bool removeDuplicates, bool removeSelfLoops) {
+	if (!weights.empty() && weights.size() != edges.size()) {
+		throw std::runtime_error("number of weights does not match the number of edges");
+	}
+
+	// bucket the edges by their first endpoint, for undirected graphs the smaller one
+	auto first = [&](index i) {
+		return directed ? edges[i].first : std::min(edges[i].first, edges[i].second);
+	};
+	auto second = [&](index i) {
+		return directed ? edges[i].second : std::max(edges[i].first, edges[i].second);
+	};
+	std::vector<index> firstOffsets;
+	std::vector<index> byFirst;
+	stableCountingSort(edges.size(), n, [&](index i) {
+		return (removeSelfLoops && edges[i].first == edges[i].second) ? none : first(i);
+	}, firstOffsets, byFirst);
+
+	std::vector<index> firstEnd(firstOffsets.begin() + 1, firstOffsets.end());
+	if (removeDuplicates) {
+		// the buckets are in input order, so a stable sort by the second endpoint keeps the first occurrence in front
+		#pragma omp parallel for schedule(guided)
+		for (node u = 0; u < n; ++u) {
+			auto begin = byFirst.begin() + firstOffsets[u];
+			auto end = byFirst.begin() + firstOffsets[u + 1];
+			std::stable_sort(begin, end, [&](index i, index j) {
+				return second(i) < second(j);
+			});
+			firstEnd[u] = std::unique(begin, end, [&](index i, index j) {
+				return second(i) == second(j);
+			}) - byFirst.begin();
+		}
+	}
+
+	// bucket the remaining edges by their second endpoint for the other half edges
+	std::vector<index> kept(edges.size(), none);
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < n; ++u) {
+		for (index k = firstOffsets[u]; k < firstEnd[u]; ++k) {
+			kept[byFirst[k]] = byFirst[k];
+		}
+	}
+	std::vector<index> secondOffsets;
+	std::vector<index> bySecond;
+	stableCountingSort(edges.size(), n, [&](index i) {
+		// self loops of undirected graphs have only one half edge
+		return (kept[i] == none || (!directed && edges[i].first == edges[i].second)) ? none : second(i);
+	}, secondOffsets, bySecond);
+	std::vector<index>().swap(kept);
+
+	auto weight = [&](index i) {
+		return weights.empty() ? defaultEdgeWeight : weights[i];
+	};
+
+	count addedSelfLoops = 0;
+	#pragma omp parallel for schedule(guided) reduction(+:addedSelfLoops)
+	for (node u = 0; u < n; ++u) {
+		const count firstHalves = firstEnd[u] - firstOffsets[u];
+		const count secondHalves = secondOffsets[u + 1] - secondOffsets[u];
+		std::vector<node>& reverse = directed ? inEdges[u] : outEdges[u];
+		outEdges[u].reserve(outEdges[u].size() + firstHalves + (directed ? 0 : secondHalves));
+		reverse.reserve(reverse.size() + secondHalves);
+		if (weighted) {
+			outEdgeWeights[u].reserve(outEdgeWeights[u].size() + firstHalves + (directed ? 0 : secondHalves));
+		}
+		for (index k = firstOffsets[u]; k < firstEnd[u]; ++k) {
+			index i = byFirst[k];
+			outEdges[u].push_back(second(i));
+			if (weighted) {
+				outEdgeWeights[u].push_back(weight(i));
+			}
+			if (second(i) == u) {
+				addedSelfLoops += directed ? 2 : 1;
+			}
+		}
+		for (index k = secondOffsets[u]; k < secondOffsets[u + 1]; ++k) {
+			index i = bySecond[k];
+			reverse.push_back(first(i));
+			if (weighted) {
+				(directed ? inEdgeWeights[u] : outEdgeWeights[u]).push_back(weight(i));
+			}
+		}
+	}
+	selfloops += addedSelfLoops;
+}
+
 void GraphBuilder::setDegrees(Graph& G) {
 	#pragma omp parallel for
 	for (node v = 0; v < n; v++) {
@@ -113,6 +113,21 @@ public:
 
 	void swapNeighborhood(node u, std::vector<node> &neighbours, std::vector<edgeweight> &weights, bool selfloop);
 
+	/**
+	 * Adds a batch of edges given as (source, target) pairs. Unlike addHalfEdge, both half edges of every edge
+	 * are added, so the batch is complete and toGraph(false) only has to move the adjacencies into the graph.
+	 * The edges are bucketed by their endpoints with a parallel stable counting sort, no per-edge checks are done.
+	 * Not threadsafe, but parallel internally.
+	 *
+	 * @param edges The edges.
+	 * @param weights Edge weights in the order of @a edges; if empty, all edges get the default weight.
+	 * @param removeDuplicates If @c true, only the first occurrence of an edge in @a edges is added (for undirected
+	 * graphs (u, v) and (v, u) are the same edge). Edges added before are not taken into account.
+	 * @param removeSelfLoops If @c true, self loops are skipped.
+	 */
+	void addEdges(const std::vector<std::pair<node, node>>& edges, const std::vector<edgeweight>& weights = {},
+			bool removeDuplicates = false, bool removeSelfLoops = false);
+
 	/**
 	 * Set the weight of an edge. If the edge does not exist,
 	 * it will be inserted.
@@ -177,6 +192,9 @@ private:
 
 	template <typename T>
 	static void copyAndClear(std::vector<T>& source, std::vector<T>& target);
+
+	template <typename K>
+	static void stableCountingSort(count items, count buckets, K key, std::vector<index>& offsets, std::vector<index>& sorted);
 	
 	void setDegrees(Graph& G);
 	count numberOfEdges(const Graph& G);
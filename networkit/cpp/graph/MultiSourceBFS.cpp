@@ -0,0 +1,16 @@
+/*
+ * MultiSourceBFS.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "MultiSourceBFS.h"
+
+namespace NetworKit {
+
+constexpr count MultiSourceBFS::batchSize;
+
+MultiSourceBFS::MultiSourceBFS(const Graph& G) : G(G) {
+}
+
+} /* namespace NetworKit */
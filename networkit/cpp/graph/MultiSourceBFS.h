@@ -0,0 +1,163 @@
+/*
+ * MultiSourceBFS.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef MULTISOURCEBFS_H_
+#define MULTISOURCEBFS_H_
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Multi-source breadth-first search (MS-BFS) which advances the searches of up to 64 sources at once.
+ *
+ * Each node keeps three 64-bit masks (sources that have seen it, that visit it in the current level and
+ * that visit it in the next level), so one scan of a neighborhood serves all sources of a batch. Batches of
+ * 64 sources are processed in parallel, every thread reuses its own masks and frontier buffers.
+ * See Then et al., "The More the Merrier: Efficient Multi-Source Graph Traversal", VLDB 2014.
+ *
+ * Only hop distances are computed, so the engine is meant for all-pairs-style workloads on unweighted graphs.
+ */
+class MultiSourceBFS {
+
+public:
+	typedef uint64_t mask;
+
+	static constexpr count batchSize = 8 * sizeof(mask);
+
+	/**
+	 * Creates the MS-BFS engine for @a G. For directed graphs the searches follow outgoing edges.
+	 *
+	 * @param G The graph.
+	 */
+	MultiSourceBFS(const Graph& G);
+
+	/**
+	 * Runs a BFS from each node in @a sources and calls @a handle(i, v, dist) once for every source index i
+	 * and every node v reachable from sources[i], where dist is the hop distance. The calls for the same source
+	 * index are made by the same thread in non-decreasing order of distance; calls for different sources may run
+	 * concurrently.
+	 *
+	 * @param sources The source nodes.
+	 * @param handle Takes parameters <code>(index, node, count)</code>.
+	 */
+	template<typename L> void run(const std::vector<node>& sources, L handle) const;
+
+	/**
+	 * Per-thread buffers of the engine, reused across batches.
+	 */
+	struct State {
+		std::vector<mask> seen;
+		std::vector<mask> visit;
+		std::vector<mask> visitNext;
+		std::vector<node> frontier;
+		std::vector<node> nextFrontier;
+	};
+
+	/**
+	 * Runs the BFS from the @a k <= batchSize nodes at @a sources sequentially, reusing the buffers in @a state.
+	 * @a handle takes parameters <code>(node v, count dist, mask reached)</code> and is called once per level for
+	 * every node v reached in that level; bit i of reached stands for sources[i].
+	 */
+	template<typename L> void runBatch(const node* sources, count k, State& state, L handle) const;
+
+private:
+	const Graph& G;
+};
+
+template<typename L>
+void MultiSourceBFS::runBatch(const node* sources, count k, State& state, L handle) const {
+	const count z = G.upperNodeIdBound();
+	if (state.seen.size() != z) {
+		state.seen.assign(z, 0);
+		state.visit.assign(z, 0);
+		state.visitNext.assign(z, 0);
+	}
+	std::vector<mask>& seen = state.seen;
+	std::vector<mask>& visit = state.visit;
+	std::vector<mask>& visitNext = state.visitNext;
+	std::vector<node>& frontier = state.frontier;
+	std::vector<node>& nextFrontier = state.nextFrontier;
+	std::vector<node> touched; // all nodes with a non-zero seen mask, reset at the end
+	frontier.clear();
+
+	for (index i = 0; i < k; ++i) {
+		node s = sources[i];
+		if (seen[s] == 0) {
+			frontier.push_back(s);
+			touched.push_back(s);
+		}
+		seen[s] |= mask(1) << i;
+		visit[s] |= mask(1) << i;
+	}
+	for (node s : frontier) {
+		handle(s, 0, seen[s]);
+	}
+
+	count dist = 0;
+	while (!frontier.empty()) {
+		++dist;
+		nextFrontier.clear();
+		for (node u : frontier) {
+			const mask current = visit[u];
+			G.forNeighborsOf(u, [&](node v) {
+				mask reached = current & ~seen[v];
+				if (reached != 0) {
+					if (visitNext[v] == 0) {
+						nextFrontier.push_back(v);
+					}
+					visitNext[v] |= reached;
+				}
+			});
+			visit[u] = 0;
+		}
+		for (node v : nextFrontier) {
+			if (seen[v] == 0) {
+				touched.push_back(v);
+			}
+			seen[v] |= visitNext[v];
+			visit[v] = visitNext[v];
+			visitNext[v] = 0;
+			handle(v, dist, visit[v]);
+		}
+		frontier.swap(nextFrontier);
+	}
+
+	for (node v : touched) {
+		seen[v] = 0;
+	}
+}
+
+template<typename L>
+void MultiSourceBFS::run(const std::vector<node>& sources, L handle) const {
+	const count nBatches = (sources.size() + batchSize - 1) / batchSize;
+
+	#pragma omp parallel
+	{
+		State state;
+		#pragma omp for schedule(dynamic, 1)
+		for (index b = 0; b < nBatches; ++b) {
+			const index first = b * batchSize;
+			const count k = std::min(batchSize, sources.size() - first);
+			runBatch(sources.data() + first, k, state, [&](node v, count dist, mask reached) {
+				while (reached != 0) {
+					index i = __builtin_ctzll(reached);
+					reached &= reached - 1;
+					handle(first + i, v, dist);
+				}
+			});
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* MULTISOURCEBFS_H_ */
@@ -0,0 +1,154 @@
+/*
+ * CSRGraphGTest.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef NOGTEST
+
+#include <algorithm>
+
+#include "CSRGraphGTest.h"
+#include "../CSRGraph.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
+
+namespace NetworKit {
+
+namespace {
+
+// a generic BFS to check that algorithms can be instantiated on both graph types
+template<class GraphType>
+std::vector<count> bfsDistances(const GraphType& G, node source) {
+	std::vector<count> dist(G.upperNodeIdBound(), none);
+	G.BFSfrom(source, [&](node u, count d) {
+		dist[u] = d;
+	});
+	return dist;
+}
+
+template<class GraphType>
+std::vector<count> parallelBfsDistances(const GraphType& G, node source) {
+	std::vector<count> dist(G.upperNodeIdBound(), none);
+	G.parallelBFSfrom(source, [&](node u, count d) {
+		dist[u] = d;
+	});
+	return dist;
+}
+
+Graph randomGraph(count n, double p, bool weighted, bool directed) {
+	Graph G = ErdosRenyiGenerator(n, p, directed).generate();
+	if (weighted) {
+		Graph W(G, true, directed);
+		W.forEdges([&](node u, node v) {
+			W.setWeight(u, v, Aux::Random::real(0.5, 2.0));
+		});
+		return W;
+	}
+	return G;
+}
+
+}
+
+TEST_F(CSRGraphGTest, testSameEdgesAsGraph) {
+	for (bool weighted : {false, true}) {
+		for (bool directed : {false, true}) {
+			Graph G = randomGraph(200, 0.05, weighted, directed);
+			G.addEdge(3, 3);
+			G.indexEdges();
+			CSRGraph C(G);
+
+			EXPECT_EQ(G.numberOfNodes(), C.numberOfNodes());
+			EXPECT_EQ(G.numberOfEdges(), C.numberOfEdges());
+			EXPECT_EQ(G.numberOfSelfLoops(), C.numberOfSelfLoops());
+			EXPECT_EQ(G.upperEdgeIdBound(), C.upperEdgeIdBound());
+			EXPECT_EQ(weighted, C.isWeighted());
+			EXPECT_EQ(directed, C.isDirected());
+			EXPECT_TRUE(C.hasEdgeIds());
+			EXPECT_NEAR(G.totalEdgeWeight(), C.totalEdgeWeight(), 1e-9);
+
+			G.forNodes([&](node u) {
+				EXPECT_EQ(G.degree(u), C.degree(u));
+				EXPECT_EQ(G.degreeIn(u), C.degreeIn(u));
+				EXPECT_NEAR(G.weightedDegree(u), C.weightedDegree(u), 1e-9);
+				EXPECT_NEAR(G.volume(u), C.volume(u), 1e-9);
+			});
+
+			std::vector<std::tuple<node, node, edgeweight, edgeid>> expected, actual;
+			G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+				expected.emplace_back(u, v, ew, eid);
+			});
+			C.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+				actual.emplace_back(u, v, ew, eid);
+				EXPECT_TRUE(C.hasEdge(u, v));
+				EXPECT_EQ(G.weight(u, v), C.weight(u, v));
+				EXPECT_EQ(G.edgeId(u, v), C.edgeId(u, v));
+			});
+			EXPECT_EQ(expected, actual);
+
+			G.forNodes([&](node u) {
+				std::vector<node> gIn, cIn;
+				G.forInNeighborsOf(u, [&](node v) { gIn.push_back(v); });
+				C.forInNeighborsOf(u, [&](node v) { cIn.push_back(v); });
+				EXPECT_EQ(gIn, cIn);
+				EXPECT_EQ(G.neighbors(u), C.neighbors(u));
+			});
+
+			double gSum = G.parallelSumForEdges([](node u, node v, edgeweight ew) { return ew * (u + v); });
+			double cSum = C.parallelSumForEdges([](node u, node v, edgeweight ew) { return ew * (u + v); });
+			EXPECT_NEAR(gSum, cSum, 1e-6);
+
+			EXPECT_EQ(bfsDistances(G, 0), bfsDistances(C, 0));
+			EXPECT_EQ(bfsDistances(G, 0), parallelBfsDistances(C, 0));
+		}
+	}
+}
+
+TEST_F(CSRGraphGTest, testDeletedNodesAndEdges) {
+	Graph G(6, true);
+	G.addEdge(0, 1, 2.0);
+	G.addEdge(1, 2, 3.0);
+	G.addEdge(2, 3, 4.0);
+	G.addEdge(3, 0, 5.0);
+	G.addEdge(4, 0, 6.0);
+	G.removeEdge(1, 2);
+	G.removeEdge(4, 0);
+	G.removeNode(4);
+
+	CSRGraph C(G);
+	EXPECT_EQ(5u, C.numberOfNodes());
+	EXPECT_EQ(6u, C.upperNodeIdBound());
+	EXPECT_EQ(3u, C.numberOfEdges());
+	EXPECT_FALSE(C.hasNode(4));
+	EXPECT_FALSE(C.hasEdge(1, 2));
+	EXPECT_TRUE(C.hasEdge(2, 3));
+	EXPECT_EQ(1u, C.degree(1));
+	EXPECT_EQ(7.0, C.weightedDegree(0));
+
+	count nodes = 0;
+	C.forNodes([&](node) { ++nodes; });
+	EXPECT_EQ(5u, nodes);
+}
+
+TEST_F(CSRGraphGTest, testToGraph) {
+	for (bool weighted : {false, true}) {
+		for (bool directed : {false, true}) {
+			Graph G = randomGraph(100, 0.1, weighted, directed);
+			G.indexEdges();
+			Graph H = CSRGraph(G).toGraph();
+
+			EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+			EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+			EXPECT_TRUE(H.checkConsistency());
+			G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+				EXPECT_TRUE(H.hasEdge(u, v));
+				EXPECT_EQ(ew, H.weight(u, v));
+				EXPECT_EQ(eid, H.edgeId(u, v));
+			});
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
@@ -0,0 +1,23 @@
+/*
+ * CSRGraphGTest.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef NOGTEST
+
+#ifndef CSRGRAPHGTEST_H_
+#define CSRGRAPHGTEST_H_
+
+#include <gtest/gtest.h>
+
+namespace NetworKit {
+
+class CSRGraphGTest: public testing::Test {
+};
+
+} /* namespace NetworKit */
+
+#endif /* CSRGRAPHGTEST_H_ */
+
+#endif /* NOGTEST */
@@ -561,6 +561,73 @@ TEST_P(GraphBuilderDirectSwapGTest, testParallelForNodePairs) {
 	}
 }
 
+TEST_P(GraphBuilderDirectSwapGTest, testAddEdges) {
+	auto b = createGraphBuilder(n_house);
+	std::vector<edgeweight> weights;
+	for (auto& e : houseEdgesOut) {
+		weights.push_back(Ahouse[e.first][e.second]);
+	}
+	b.addEdges(houseEdgesOut, weights);
+	Graph G = toGraph(b);
+
+	ASSERT_EQ(n_house, G.numberOfNodes());
+	ASSERT_EQ(m_house, G.numberOfEdges());
+	ASSERT_TRUE(G.checkConsistency());
+	for (node u = 0; u < n_house; u++) {
+		for (node v = 0; v < n_house; v++) {
+			ASSERT_EQ(Ahouse[u][v], G.weight(u, v));
+		}
+	}
+}
+
+TEST_P(GraphBuilderDirectSwapGTest, testAddEdgesDuplicatesAndSelfLoops) {
+	const count n = 200;
+	std::vector< std::pair<node, node> > edges;
+	std::vector<edgeweight> weights;
+	for (index i = 0; i < 5000; i++) {
+		edges.emplace_back(Aux::Random::integer(n - 1), Aux::Random::integer(n - 1));
+		weights.push_back(Aux::Random::real());
+	}
+
+	for (bool removeSelfLoops : {false, true}) {
+		// reference: the first occurrence of every edge
+		Graph R(n, isWeighted(), isDirected());
+		for (index i = 0; i < edges.size(); i++) {
+			node u = edges[i].first;
+			node v = edges[i].second;
+			if (!R.hasEdge(u, v) && !(removeSelfLoops && u == v)) {
+				R.addEdge(u, v, weights[i]);
+			}
+		}
+
+		auto b = createGraphBuilder(n);
+		b.addEdges(edges, weights, true, removeSelfLoops);
+		Graph G = toGraph(b);
+
+		ASSERT_EQ(R.numberOfEdges(), G.numberOfEdges());
+		ASSERT_EQ(R.numberOfSelfLoops(), G.numberOfSelfLoops());
+		if (removeSelfLoops) {
+			ASSERT_EQ(0u, G.numberOfSelfLoops());
+		}
+		R.forEdges([&](node u, node v, edgeweight w) {
+			ASSERT_TRUE(G.hasEdge(u, v));
+			ASSERT_EQ(w, G.weight(u, v));
+		});
+		G.forNodes([&](node u) {
+			ASSERT_EQ(R.degree(u), G.degree(u));
+			if (isDirected()) {
+				ASSERT_EQ(R.degreeIn(u), G.degreeIn(u));
+			}
+		});
+	}
+
+	// without removal every occurrence is an edge
+	auto b = createGraphBuilder(n);
+	b.addEdges(edges);
+	Graph G = toGraph(b);
+	ASSERT_EQ(edges.size(), G.numberOfEdges());
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -10,6 +10,10 @@
 #include "../BFS.h"
 #include "../DynDijkstra.h"
 #include "../Dijkstra.h"
+#include "../MultiSourceBFS.h"
+#include "../DirOptBFS.h"
+#include "../DeltaStepping.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/Log.h"
 
@@ -190,4 +194,112 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
 	EXPECT_EQ(sssp.distance(6), 1);
 	EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testMultiSourceBFS) {
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(150, 0.02, directed).generate();
+		std::vector<node> sources = G.nodes();
+		std::vector<std::vector<count>> msDist(sources.size(), std::vector<count>(G.upperNodeIdBound(), none));
+		MultiSourceBFS msbfs(G);
+		msbfs.run(sources, [&](index i, node v, count dist) {
+			EXPECT_EQ(none, msDist[i][v]);
+			msDist[i][v] = dist;
+		});
+
+		for (index i = 0; i < sources.size(); ++i) {
+			BFS bfs(G, sources[i], false);
+			bfs.run();
+			G.forNodes([&](node v) {
+				if (bfs.distance(v) == std::numeric_limits<edgeweight>::max()) {
+					EXPECT_EQ(none, msDist[i][v]);
+				} else {
+					EXPECT_EQ(bfs.distance(v), msDist[i][v]);
+				}
+			});
+		}
+	}
+}
+
+TEST_F(SSSPGTest, testDirOptBFS) {
+	for (bool directed : {false, true}) {
+		// dense enough for the search to switch to bottom-up steps and back
+		Graph G = ErdosRenyiGenerator(2000, 0.004, directed).generate();
+		G.removeNode(G.addNode()); // deleted node must be skipped
+		node source = 0;
+
+		BFS bfs(G, source, false);
+		bfs.run();
+		DirOptBFS dobfs(G, source, true);
+		dobfs.run();
+
+		G.forNodes([&](node v) {
+			EXPECT_EQ(bfs.distance(v), dobfs.distance(v));
+		});
+
+		std::vector<node> stack = dobfs.getStack();
+		count reached = 0;
+		G.forNodes([&](node v) {
+			if (bfs.distance(v) != std::numeric_limits<edgeweight>::max()) {
+				++reached;
+			}
+		});
+		EXPECT_EQ(reached, stack.size());
+		for (index i = 1; i < stack.size(); ++i) {
+			EXPECT_LE(dobfs.distance(stack[i - 1]), dobfs.distance(stack[i]));
+		}
+	}
+}
+
+TEST_F(SSSPGTest, testDeltaStepping) {
+	for (bool directed : {false, true}) {
+		Graph G(ErdosRenyiGenerator(1000, 0.005, directed).generate(), true, directed);
+		// small integer weights, so that many nodes are reached by several shortest paths
+		G.forEdges([&](node u, node v) {
+			G.setWeight(u, v, (u * 7 + v * 3) % 5 + 1);
+		});
+		node source = 0;
+
+		Dijkstra dijk(G, source, true, true);
+		dijk.run();
+		for (edgeweight delta : {0.0, 0.25, 1.0, 10.0}) {
+			DeltaStepping ds(G, source, true, true, delta);
+			ds.run();
+
+			count reached = 0;
+			G.forNodes([&](node v) {
+				EXPECT_EQ(dijk.distance(v), ds.distance(v));
+				if (dijk.distance(v) == std::numeric_limits<edgeweight>::max()) {
+					return;
+				}
+				++reached;
+				EXPECT_EQ(dijk.numberOfPaths(v), ds.numberOfPaths(v));
+				std::vector<node> expected = dijk.getPredecessors(v);
+				std::vector<node> actual = ds.getPredecessors(v);
+				std::sort(expected.begin(), expected.end());
+				std::sort(actual.begin(), actual.end());
+				EXPECT_EQ(expected, actual);
+			});
+
+			std::vector<node> stack = ds.getStack();
+			EXPECT_EQ(reached, stack.size());
+			for (index i = 1; i < stack.size(); ++i) {
+				EXPECT_LE(ds.distance(stack[i - 1]), ds.distance(stack[i]));
+			}
+		}
+	}
+}
+
+TEST_F(SSSPGTest, testDeltaSteppingRejectsNonPositiveWeights) {
+	Graph G(3, true);
+	G.addEdge(0, 1, 1.0);
+	G.addEdge(1, 2, 0.0);
+	EXPECT_THROW(DeltaStepping(G, 0), std::runtime_error);
+	G.setWeight(1, 2, -1.0);
+	EXPECT_THROW(DeltaStepping(G, 0), std::runtime_error);
+	G.setWeight(1, 2, 2.0);
+	DeltaStepping ds(G, 0);
+	ds.run();
+	EXPECT_EQ(3.0, ds.distance(2));
+}
+
 }
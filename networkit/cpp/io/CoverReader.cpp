@@ -9,22 +9,20 @@ NetworKit::Cover NetworKit::CoverReader::read(std::string path, NetworKit::Graph
 	if (!file.good()) {
 		throw std::runtime_error("unable to read from file");
 	}
-	Cover communities(G.upperNodeIdBound());
+	std::vector<std::vector<node>> subsets;
 	std::string line;
-	count i = 0;
 	node current;
 
 	while (std::getline(file, line)) {
 		if (line.substr(0, 1) != "#") {
-			communities.setUpperBound(i+1);
+			subsets.emplace_back();
 			std::stringstream linestream(line);
 			while (linestream >> current) {
-				communities.addToSubset(i, current);
+				subsets.back().push_back(current);
 			}
-			++i;
 		}
 	}
 
 	file.close();
-	return communities;
+	return Cover(G.upperNodeIdBound(), subsets);
 }
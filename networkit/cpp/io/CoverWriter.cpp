@@ -7,7 +7,7 @@ void NetworKit::CoverWriter::write(Cover& zeta, const std::string& path) const {
 	std::ofstream file{path};
 
 	std::vector<std::vector<index> > sets(zeta.upperBound());
-	zeta.forEntries([&](index v, const std::set<index> &c){
+	zeta.forEntries([&](index v, const std::vector<index> &c){
 		for (auto &s : c) {
 			sets[s].push_back(v);
 		}
@@ -6,14 +6,199 @@
  */
 
 #include "EdgeListReader.h"
+#include "MemoryMappedFile.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
+#include "../graph/GraphBuilder.h"
 
 #include <sstream>
+#include <unordered_map>
+#include <omp.h>
 
 #include "../auxiliary/Enforce.h"
 
 namespace NetworKit {
 
+namespace {
+
+struct Edge {
+	node u;
+	node v;
+	edgeweight w;
+};
+
+/**
+ * What the parser found in one chunk of the file. Line numbers are relative to the chunk.
+ */
+struct Chunk {
+	const char* begin;
+	const char* end;
+	count lines = 0;
+	index firstDataLine = none;
+	count firstDataFields = 0;
+	index firstWeightedLine = none;
+	index errorLine = none;
+	std::string errorText;
+	std::vector<Edge> edges;
+	node maxNode = 0; // continuous ids only
+	std::unordered_map<std::string, node> localIds; // non-continuous ids only, chunk-local numbering
+	std::vector<std::string> labels; // non-continuous ids only, in order of first appearance
+};
+
+/**
+ * Splits the lines of @a chunk into their fields and calls @a handle(fields, numberOfFields, line) for every
+ * line with two or three fields. Comment lines and empty lines are skipped, all other lines and parse errors
+ * are recorded in the chunk.
+ */
+template<typename L>
+void parseChunk(Chunk& chunk, char separator, const std::string& commentPrefix, L handle) {
+	std::pair<const char*, const char*> fields[3];
+	const char* lineBegin = chunk.begin;
+	while (lineBegin < chunk.end) {
+		const char* lineEnd = std::find(lineBegin, chunk.end, '\n');
+		const char* next = (lineEnd == chunk.end) ? lineEnd : lineEnd + 1;
+		if (lineEnd > lineBegin && *(lineEnd - 1) == '\r') {
+			--lineEnd;
+		}
+		index line = chunk.lines++;
+		count length = lineEnd - lineBegin;
+		bool comment = length >= commentPrefix.length() && std::equal(commentPrefix.begin(), commentPrefix.end(), lineBegin);
+		if (length > 0 && !comment) {
+			// same splitting as Aux::StringTools::split, a trailing separator does not start a new field
+			count numberOfFields = 0;
+			const char* it = lineBegin;
+			while (it != lineEnd) {
+				const char* tmp = std::find(it, lineEnd, separator);
+				if (numberOfFields < 3) {
+					fields[numberOfFields] = std::make_pair(it, tmp);
+				}
+				++numberOfFields;
+				if (tmp == lineEnd) {
+					break;
+				}
+				it = tmp + 1;
+			}
+			if (chunk.firstDataLine == none) {
+				chunk.firstDataLine = line;
+				chunk.firstDataFields = numberOfFields;
+			}
+			bool ok = (numberOfFields == 2 || numberOfFields == 3);
+			if (ok) {
+				if (numberOfFields == 3 && chunk.firstWeightedLine == none) {
+					chunk.firstWeightedLine = line;
+				}
+				try {
+					handle(fields, numberOfFields);
+				} catch (std::exception& e) {
+					ok = false;
+				}
+			}
+			if (!ok) {
+				chunk.errorLine = line;
+				chunk.errorText = std::string(lineBegin, lineEnd);
+				return;
+			}
+		}
+		lineBegin = next;
+	}
+}
+
+template<typename Number>
+Number parseField(const std::pair<const char*, const char*>& field) {
+	return std::get<0>(Aux::Parsing::strTo<Number, const char*, Aux::Checkers::Enforcer>(field.first, field.second));
+}
+
+/**
+ * Maps the file at @a path and runs parseChunk on pieces of it in parallel. Throws on the first malformed line
+ * and determines from the first edge line whether the graph is weighted.
+ */
+template<typename L>
+std::vector<Chunk> parseFile(const std::string& path, char separator, const std::string& commentPrefix, bool& weighted, L handle) {
+	MemoryMappedFile file(path);
+	std::vector<const char*> bounds = MemoryMappedFile::splitAtLines(file.cbegin(), file.cend(),
+			std::max<count>(4 * omp_get_max_threads(), file.size() >> 24));
+	std::vector<Chunk> chunks(bounds.size() - 1);
+	for (index c = 0; c < chunks.size(); ++c) {
+		chunks[c].begin = bounds[c];
+		chunks[c].end = bounds[c + 1];
+	}
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < chunks.size(); ++c) {
+		parseChunk(chunks[c], separator, commentPrefix, [&](const std::pair<const char*, const char*>* fields, count numberOfFields) {
+			handle(chunks[c], fields, numberOfFields);
+		});
+	}
+
+	auto malformed = [&](index line, const std::string& text) {
+		std::stringstream message;
+		message << "malformed line ";
+		message << line + 1 << ": ";
+		message << text;
+		throw std::runtime_error(message.str());
+	};
+
+	weighted = false;
+	bool checkedWeighted = false;
+	index offset = 0; // lines in preceding chunks
+	for (Chunk& chunk : chunks) {
+		if (chunk.errorLine != none) {
+			malformed(offset + chunk.errorLine, chunk.errorText);
+		}
+		if (!checkedWeighted && chunk.firstDataLine != none) {
+			weighted = (chunk.firstDataFields == 3);
+			if (weighted) {
+				INFO("Identified graph as weighted.");
+			}
+			checkedWeighted = true;
+		}
+		if (!weighted && chunk.firstWeightedLine != none) {
+			// recover the text of the offending line
+			const char* it = chunk.begin;
+			for (index l = 0; l < chunk.firstWeightedLine; ++l) {
+				it = std::find(it, chunk.end, '\n') + 1;
+			}
+			const char* lineEnd = std::find(it, chunk.end, '\n');
+			if (lineEnd > it && *(lineEnd - 1) == '\r') {
+				--lineEnd;
+			}
+			malformed(offset + chunk.firstWeightedLine, std::string(it, lineEnd));
+		}
+		offset += chunk.lines;
+	}
+	return chunks;
+}
+
+/**
+ * Assembles the graph from the edges of all chunks. As in the former line-by-line reader, only the first
+ * occurrence of an edge is kept.
+ */
+Graph buildGraph(count n, bool weighted, bool directed, std::vector<Chunk>& chunks) {
+	std::vector<index> offsets(chunks.size() + 1, 0);
+	for (index c = 0; c < chunks.size(); ++c) {
+		offsets[c + 1] = offsets[c] + chunks[c].edges.size();
+	}
+	std::vector<std::pair<node, node>> edges(offsets.back());
+	std::vector<edgeweight> weights(weighted ? offsets.back() : 0);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < chunks.size(); ++c) {
+		for (index i = 0; i < chunks[c].edges.size(); ++i) {
+			const Edge& e = chunks[c].edges[i];
+			edges[offsets[c] + i] = std::make_pair(e.u, e.v);
+			if (weighted) {
+				weights[offsets[c] + i] = e.w;
+			}
+		}
+		std::vector<Edge>().swap(chunks[c].edges);
+	}
+
+	GraphBuilder b(n, weighted, directed);
+	b.addEdges(edges, weights, true);
+	return b.toGraph(false);
+}
+
+} /* namespace */
+
 EdgeListReader::EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix, const bool continuous, const bool directed) :
 	separator(separator), commentPrefix(commentPrefix), firstNode(firstNode), continuous(continuous), mapNodeIds(), directed(directed) {
 //	this->mapNodeIds;i
@@ -35,200 +220,80 @@ std::map<std::string,node> EdgeListReader::getNodeMap() {
 }
 
 Graph EdgeListReader::readContinuous(const std::string& path) {
-	std::ifstream file(path);
-	Aux::enforceOpened(file);
-	std::string line; // the current line
-
-	// read file once to get to the last line and figure out the number of nodes
-	// unfortunately there is an empty line at the ending of the file, so we need to get the line before that
-
-	node maxNode = 0;
-	bool weighted;
-	bool checkedWeighted = false;
-
 	DEBUG("separator: " , this->separator);
 	DEBUG("first node: " , this->firstNode);
 
-	// first find out the maximum node id
-	DEBUG("first pass");
-	count i = 0;
-	while (file.good()) {
-		++i;
-		std::getline(file, line);
-		if(*line.rbegin() == '\r') line.pop_back();
-		// TRACE("read line: " , line);
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else if (line.length() == 0) {
-			// TRACE("ignoring empty line");
-		} else {
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (!checkedWeighted) {
-				if (split.size() == 2) {
-					weighted = false;
-				} else if (split.size() == 3) {
-					INFO("Identified graph as weighted.");
-					weighted = true;
-				}
-				checkedWeighted = true;
-			}
-			if (split.size() == 2 || split.size() == 3) {
-				TRACE("split into : " , split[0] , " and " , split[1]);
-				node u = std::stoul(split[0]);
-				if (u > maxNode) {
-					maxNode = u;
-				}
-				node v = std::stoul(split[1]);
-				if (v > maxNode) {
-					maxNode = v;
-				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
-			}
+	const node first = this->firstNode;
+	bool weighted;
+	std::vector<Chunk> chunks = parseFile(path, this->separator, this->commentPrefix, weighted,
+			[&](Chunk& chunk, const std::pair<const char*, const char*>* fields, count numberOfFields) {
+		node u = parseField<node>(fields[0]);
+		node v = parseField<node>(fields[1]);
+		if (u < first || v < first) {
+			throw std::runtime_error("node id smaller than first node");
 		}
+		edgeweight w = (numberOfFields == 3) ? parseField<double>(fields[2]) : defaultEdgeWeight;
+		chunk.maxNode = std::max(chunk.maxNode, std::max(u, v));
+		chunk.edges.push_back({u - first, v - first, w});
+	});
+
+	node maxNode = 0;
+	for (const Chunk& chunk : chunks) {
+		maxNode = std::max(maxNode, chunk.maxNode);
 	}
-	file.close();
 	maxNode = maxNode - this->firstNode + 1;
 	DEBUG("max. node id found: " , maxNode);
 
-	Graph G(maxNode, weighted, directed);
-
-	DEBUG("second pass");
-	file.open(path);
-	// split the line into start and end node. since the edges are sorted, the start node has the highest id of all nodes
-	i = 0; // count lines
-	while(std::getline(file,line)){
-		if(*line.rbegin() == '\r') line.pop_back();
-		++i;
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else {
-			// TRACE("edge line: " , line);
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (split.size() == 2) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v);
-				}
-			} else if (weighted && split.size() == 3) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-				double weight = std::stod(split[2]);
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v, weight);
-				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
-			}
-		}
-	}
-	file.close();
-
-	G.shrinkToFit();
-	return G;
+	return buildGraph(maxNode, weighted, directed, chunks);
 }
 
 
 Graph EdgeListReader::readNonContinuous(const std::string& path) {
-	std::ifstream file(path);
-	Aux::enforceOpened(file);
-	DEBUG("file is opened, proceed");
-	std::string line; // the current line
-	node consecutiveID = 0;
-
-	bool weighted = false;
-	bool checkedWeighted = false;
-
-	// first find out the maximum node id
-	DEBUG("first pass: create node ID mapping");
-	count i = 0;
-	while (file.good()) {
-		++i;
-		std::getline(file, line);
-		if(*line.rbegin() == '\r') line.pop_back();
-		// TRACE("read line: " , line);
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-	        } else if (line.length() == 0) {
-        		// TRACE("ignoring empty line");
-		} else {
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (!checkedWeighted) {
-				if (split.size() == 2) {
-					weighted = false;
-				} else if (split.size() == 3) {
-					INFO("Identified graph as weighted.");
-					weighted = true;
-				}
-				checkedWeighted = true;
+	// every chunk numbers the node labels it contains in order of first appearance
+	bool weighted;
+	std::vector<Chunk> chunks = parseFile(path, this->separator, this->commentPrefix, weighted,
+			[&](Chunk& chunk, const std::pair<const char*, const char*>* fields, count numberOfFields) {
+		auto localId = [&](const std::pair<const char*, const char*>& field) {
+			auto result = chunk.localIds.emplace(std::string(field.first, field.second), chunk.labels.size());
+			if (result.second) {
+				chunk.labels.push_back(result.first->first);
 			}
-			if (split.size() == 2 || split.size() == 3) {
-        			TRACE("split into : " , split[0] , " and " , split[1]);
-				if(this->mapNodeIds.insert(std::make_pair(split[0],consecutiveID)).second) ++consecutiveID;
-				if(this->mapNodeIds.insert(std::make_pair(split[1],consecutiveID)).second) ++consecutiveID;
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
+			return result.first->second;
+		};
+		node u = localId(fields[0]);
+		node v = localId(fields[1]);
+		edgeweight w = (numberOfFields == 3) ? parseField<double>(fields[2]) : defaultEdgeWeight;
+		chunk.edges.push_back({u, v, w});
+	});
+
+	// merging the chunks in file order assigns the consecutive ids in order of first appearance in the file
+	DEBUG("create node ID mapping");
+	this->mapNodeIds.clear();
+	node consecutiveID = 0;
+	std::vector<std::vector<node>> globalIds(chunks.size());
+	for (index c = 0; c < chunks.size(); ++c) {
+		globalIds[c].reserve(chunks[c].labels.size());
+		for (const std::string& label : chunks[c].labels) {
+			auto result = this->mapNodeIds.insert(std::make_pair(label, consecutiveID));
+			if (result.second) {
+				++consecutiveID;
 			}
+			globalIds[c].push_back(result.first->second);
 		}
+		std::unordered_map<std::string, node>().swap(chunks[c].localIds);
+		std::vector<std::string>().swap(chunks[c].labels);
 	}
-	file.close();
-
 	DEBUG("found ",this->mapNodeIds.size()," unique node ids");
-	Graph G(this->mapNodeIds.size(), weighted, directed);
-
-	DEBUG("second pass: add edges");
-	file.open(path);
-
-	// split the line into start and end node. since the edges are sorted, the start node has the highest id of all nodes
-	i = 0; // count lines
-	while(std::getline(file,line)){
-		if(*line.rbegin() == '\r') line.pop_back();
-        ++i;
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else {
-			// TRACE("edge line: " , line);
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (split.size() == 2) {
-				node u = this->mapNodeIds[split[0]];
-				node v = this->mapNodeIds[split[1]];
-				if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v);
-				}
-			} else if (weighted && split.size() == 3) {
-				node u = this->mapNodeIds[split[0]];
-				node v = this->mapNodeIds[split[1]];
-				double weight = std::stod(split[2]);
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v, weight);
-				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
-			}
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < chunks.size(); ++c) {
+		for (Edge& e : chunks[c].edges) {
+			e.u = globalIds[c][e.u];
+			e.v = globalIds[c][e.v];
 		}
 	}
-	DEBUG("read ",i," lines and added ",G.numberOfEdges()," edges");
-	file.close();
 
-	G.shrinkToFit();
-	return G;
+	return buildGraph(this->mapNodeIds.size(), weighted, directed, chunks);
 }
 
 } /* namespace NetworKit */
@@ -6,23 +6,52 @@
  */
 
 #include "METISGraphReader.h"
-#include "METISParser.h"
+#include "MemoryMappedFile.h"
 #include "../auxiliary/Enforce.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
 #include "../auxiliary/StringTools.h"
 #include "../graph/GraphBuilder.h"
 
+#include <functional>
+#include <omp.h>
+
 namespace NetworKit {
 
 Graph METISGraphReader::read(const std::string& path) {
 
-	METISParser parser(path);
+	MemoryMappedFile file(path);
+	const char* it = file.cbegin();
+	const char* end = file.cend();
 
-	std::tuple<count, count, index, count> header = parser.getHeader();
-	count n = std::get<0>(header);
-	count m = std::get<1>(header);
-	index fmt = std::get<2>(header);
-	count ncon = std::get<3>(header);
+	// header line, preceded by comment lines starting with '%'
+	const char* headerEnd = std::find(it, end, '\n');
+	while (it != end && *it == '%') {
+		it = (headerEnd == end) ? end : headerEnd + 1;
+		headerEnd = std::find(it, end, '\n');
+	}
+	if (it == end) {
+		throw std::runtime_error("getting METIS file header failed");
+	}
+	std::vector<count> tokens;
+	for (const char* pos = it; pos != headerEnd; ) {
+		count token;
+		std::tie(token, pos) = Aux::Parsing::strTo<count, const char*, Aux::Checkers::Enforcer>(pos, headerEnd);
+		tokens.push_back(token);
+	}
+	Aux::enforce(tokens.size() >= 2, "METIS header must contain the number of nodes and edges");
+	count n = tokens[0];
+	count m = tokens[1];
+	index fmt = 0;
+	count ncon = 0;
+	if (tokens.size() >= 3) {
+		fmt = tokens[2];
+		if (fmt >= 2) {
+			WARN("nodes are weighted; node weights will be ignored");
+		}
+		ncon = (tokens.size() == 4) ? tokens[3] : 1;
+	}
+	const char* body = (headerEnd == end) ? end : headerEnd + 1;
 
 	bool weighted;
 	if (fmt % 10 == 1) {
@@ -41,61 +70,90 @@ Graph METISGraphReader::read(const std::string& path) {
 	std::string graphName = Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
 	b.setName(graphName);
 
-	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);	// progress bar follows
+	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);
 
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-	double p = 0.0; // percentage for progress bar
-#endif
-	node u = 0; // begin with 0
-	count edgeCounter = 0;
-	if (weighted == 0) {
-		while (parser.hasNext() && u < n) {
-			std::vector<node> adjacencies = parser.getNext(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i] == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
-				}
-				node v = adjacencies[i] - 1; 	// METIS-indices are 1-based
-				Aux::Checkers::Enforcer::enforce(v >= 0 && v < n);
-				b.addHalfEdge(u, v);
-			}
-			u++; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
+	// the i-th line which is not a comment holds the adjacencies of node i; count these lines per chunk first
+	std::vector<const char*> bounds = MemoryMappedFile::splitAtLines(body, end,
+			std::max<count>(4 * omp_get_max_threads(), (end - body) >> 24));
+	const count chunks = bounds.size() - 1;
+	auto forLinesOfChunk = [&](index c, std::function<void(const char*, const char*)> handle) {
+		for (const char* line = bounds[c]; line < bounds[c + 1]; ) {
+			const char* lineEnd = std::find(line, bounds[c + 1], '\n');
+			if (*line != '%') {
+				handle(line, lineEnd);
 			}
-#endif
+			line = lineEnd + 1;
 		}
-	} else {
-		while (parser.hasNext() && u < n) {
-			std::vector<std::pair<node,double>> adjacencies = parser.getNextWithWeights(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			DEBUG("node ",u," has ",adjacencies.size()," edges");
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i].first == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
+	};
+	std::vector<node> firstNodeOfChunk(chunks + 1, 0);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < chunks; ++c) {
+		count lines = 0;
+		forLinesOfChunk(c, [&](const char*, const char*) {
+			++lines;
+		});
+		firstNodeOfChunk[c + 1] = lines;
+	}
+	for (index c = 0; c < chunks; ++c) {
+		firstNodeOfChunk[c + 1] += firstNodeOfChunk[c];
+	}
+
+	// every node is parsed by exactly one thread, so its half edges can be added concurrently
+	count edgeCounter = 0;
+	bool failed = false;
+	std::string failure;
+	#pragma omp parallel for schedule(dynamic, 1) reduction(+:edgeCounter)
+	for (index c = 0; c < chunks; ++c) {
+		node u = firstNodeOfChunk[c];
+		try {
+			forLinesOfChunk(c, [&](const char* pos, const char* lineEnd) {
+				if (u >= n) {
+					return;
 				}
-				node v = adjacencies[i].first- 1; 	// METIS-indices are 1-based
-				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				double weight = adjacencies[i].second;
-				Aux::Checkers::Enforcer::enforce(v >= 0 && v < n);
-				b.addHalfEdge(u, v, weight);
-				TRACE("(",u,",",v,",",adjacencies[i].second,")");
-			}
-			u += 1; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
+				for (index i = 0; i < ignoreFirst; ++i) {
+					// parse first values but ignore them
+					std::tie(std::ignore, pos) = Aux::Parsing::strTo<double>(pos, lineEnd);
+				}
+				while (pos != lineEnd) {
+					node v;
+					edgeweight weight = defaultEdgeWeight;
+					if (weighted) {
+						try {
+							std::tie(v, pos) = Aux::Parsing::strTo<node>(pos, lineEnd);
+							std::tie(weight, pos) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(pos, lineEnd);
+						} catch (std::exception& e) {
+							ERROR("malformed line; not all edges have been read correctly");
+							break;
+						}
+					} else {
+						std::tie(v, pos) = Aux::Parsing::strTo<node>(pos, lineEnd);
+					}
+					++edgeCounter;
+					if (v == 0) {
+						ERROR("METIS Node ID should not be 0, edge ignored.");
+						continue;
+					}
+					v = v - 1; 	// METIS-indices are 1-based
+					Aux::Checkers::Enforcer::enforce(v >= 0 && v < n);
+					if (weighted) {
+						// correct edgeCounter for selfloops
+						edgeCounter += (u == v);
+					}
+					b.addHalfEdge(u, v, weight);
+				}
+				++u; // next node
+			});
+		} catch (std::exception& e) {
+			#pragma omp critical
+			{
+				failed = true;
+				failure = e.what();
 			}
-#endif
 		}
 	}
+	if (failed) {
+		throw std::runtime_error("METIS file " + path + " could not be read: " + failure);
+	}
 
 	auto G = b.toGraph(false);
 
@@ -0,0 +1,60 @@
+/*
+ * MemoryMappedFile.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "MemoryMappedFile.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NetworKit {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) : data(nullptr), length(0) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw std::runtime_error("could not open file: " + path);
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		close(fd);
+		throw std::runtime_error("could not determine size of file: " + path);
+	}
+	length = info.st_size;
+	if (length > 0) {
+		void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p == MAP_FAILED) {
+			close(fd);
+			throw std::runtime_error("could not map file into memory: " + path);
+		}
+		data = static_cast<const char*>(p);
+	}
+	close(fd); // the mapping stays valid after closing the descriptor
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+	if (data != nullptr) {
+		munmap(const_cast<char*>(data), length);
+	}
+}
+
+std::vector<const char*> MemoryMappedFile::splitAtLines(const char* begin, const char* end, count parts) {
+	const count length = end - begin;
+	parts = std::max<count>(1, std::min(parts, length));
+	std::vector<const char*> bounds(parts + 1);
+	bounds[0] = begin;
+	for (index i = 1; i < parts; ++i) {
+		const char* pos = std::max(bounds[i - 1], begin + i * (length / parts));
+		pos = std::find(pos, end, '\n');
+		bounds[i] = (pos == end) ? pos : pos + 1;
+	}
+	bounds[parts] = end;
+	return bounds;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,51 @@
+/*
+ * MemoryMappedFile.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef MEMORYMAPPEDFILE_H_
+#define MEMORYMAPPEDFILE_H_
+
+#include <string>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Read-only view on a file which is mapped into memory. The mapping is released on destruction.
+ */
+class MemoryMappedFile {
+public:
+	/**
+	 * Maps the file at @a path into memory, throws std::runtime_error if that fails.
+	 */
+	MemoryMappedFile(const std::string& path);
+
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile& other) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+
+	const char* cbegin() const { return data; }
+
+	const char* cend() const { return data + length; }
+
+	count size() const { return length; }
+
+	/**
+	 * Splits the range [@a begin, @a end) of a file into at most @a parts consecutive pieces of roughly equal size
+	 * which start at the beginning of a line. Returns the start of every piece followed by @a end.
+	 */
+	static std::vector<const char*> splitAtLines(const char* begin, const char* end, count parts);
+
+private:
+	const char* data;
+	count length;
+};
+
+} /* namespace NetworKit */
+#endif /* MEMORYMAPPEDFILE_H_ */
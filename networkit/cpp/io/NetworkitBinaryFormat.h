@@ -0,0 +1,55 @@
+/*
+ * NetworkitBinaryFormat.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef NETWORKITBINARYFORMAT_H_
+#define NETWORKITBINARYFORMAT_H_
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * Layout of the native NetworKit binary graph format, see NetworkitBinaryWriter.
+ *
+ * The file starts with the header below, followed by the sections
+ *   exists bitmap (ceil(z / 64) words), out offsets (z + 1), out targets (outArcs),
+ *   [out weights (outArcs)], [out edge ids (outArcs)],
+ * and for directed graphs the same four sections for the incoming adjacencies. All entries are 8 bytes wide
+ * and stored in the byte order of the writing machine, so every section is naturally aligned and can be used
+ * in place after mapping the file into memory.
+ */
+namespace NetworkitBinary {
+
+constexpr char magic[8] = {'N', 'W', 'K', 'C', 'S', 'R', '\0', '\0'};
+constexpr uint64_t byteOrderMark = 0x0102030405060708ULL;
+constexpr uint64_t version = 2;
+
+enum Flags : uint64_t {
+	weighted = 1,
+	directed = 2,
+	edgeIds = 4
+};
+
+struct Header {
+	char magic[8];
+	uint64_t byteOrder;
+	uint64_t version;
+	uint64_t flags;
+	uint64_t z; //!< upper bound of node ids
+	uint64_t n; //!< number of nodes
+	uint64_t m; //!< number of edges
+	uint64_t omega; //!< upper bound of edge ids
+	uint64_t selfLoops; //!< number of self loops
+	uint64_t outArcs; //!< entries in the outgoing adjacency arrays
+	uint64_t inArcs; //!< entries in the incoming adjacency arrays, 0 for undirected graphs
+};
+
+static_assert(sizeof(Header) == 88, "binary header must not contain padding");
+
+} /* namespace NetworkitBinary */
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYFORMAT_H_ */
@@ -0,0 +1,157 @@
+/*
+ * NetworkitBinaryReader.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "NetworkitBinaryReader.h"
+#include "NetworkitBinaryFormat.h"
+
+#include "MemoryMappedFile.h"
+
+#include <algorithm>
+#include <memory>
+#include <omp.h>
+
+namespace NetworKit {
+
+Graph NetworkitBinaryReader::read(const std::string& path) {
+	return readCSR(path).toGraph();
+}
+
+CSRGraph NetworkitBinaryReader::readCSR(const std::string& path) {
+	auto file = std::make_shared<MemoryMappedFile>(path);
+	const uint64_t fileSize = file->size();
+	if (fileSize < sizeof(NetworkitBinary::Header)) {
+		throw std::runtime_error("file is too small for a NetworKit binary graph: " + path);
+	}
+	const char* data = file->cbegin();
+
+	const NetworkitBinary::Header& header = *reinterpret_cast<const NetworkitBinary::Header*>(data);
+	if (!std::equal(NetworkitBinary::magic, NetworkitBinary::magic + 8, header.magic)) {
+		throw std::runtime_error("not a NetworKit binary graph: " + path);
+	}
+	if (header.byteOrder != NetworkitBinary::byteOrderMark) {
+		throw std::runtime_error("byte order of the file does not match this machine: " + path);
+	}
+	if (header.version != NetworkitBinary::version) {
+		throw std::runtime_error("unsupported version of the NetworKit binary format: " + path);
+	}
+
+	const bool weighted = header.flags & NetworkitBinary::weighted;
+	const bool directed = header.flags & NetworkitBinary::directed;
+	const bool indexed = header.flags & NetworkitBinary::edgeIds;
+	const count z = header.z;
+
+	// check the size before touching any section. Every count is bounded by the number of words in the file
+	// before it is multiplied, and the sum is checked after every section, so a crafted header cannot wrap around
+	const uint64_t maxWords = (fileSize - sizeof(NetworkitBinary::Header)) / sizeof(uint64_t);
+	if (z >= maxWords || header.outArcs > maxWords || header.inArcs > maxWords) {
+		throw std::runtime_error("size of the file does not match its header: " + path);
+	}
+	uint64_t words = (z + 63) / 64;
+	auto addSection = [&](uint64_t arcs) {
+		words += (z + 1) + arcs * (1 + (weighted ? 1 : 0) + (indexed ? 1 : 0));
+		if (words > maxWords) {
+			throw std::runtime_error("size of the file does not match its header: " + path);
+		}
+	};
+	addSection(header.outArcs);
+	if (directed) {
+		addSection(header.inArcs);
+	}
+	if (fileSize != sizeof(NetworkitBinary::Header) + words * sizeof(uint64_t)) {
+		throw std::runtime_error("size of the file does not match its header: " + path);
+	}
+
+	// undirected graphs store every edge in both directions except self loops
+	const bool arcsMatch = directed
+		? header.outArcs == header.m && header.inArcs == header.m
+		: header.selfLoops <= header.outArcs && header.outArcs + header.selfLoops == 2 * header.m;
+	if (!arcsMatch) {
+		throw std::runtime_error("number of edges does not match the adjacency arrays: " + path);
+	}
+
+	const uint64_t* pos = reinterpret_cast<const uint64_t*>(data + sizeof(NetworkitBinary::Header));
+	std::vector<bool> exists(z);
+	for (node u = 0; u < z; ++u) {
+		exists[u] = (pos[u / 64] >> (u % 64)) & 1;
+	}
+	pos += (z + 63) / 64;
+
+	struct Sections {
+		const index* offsets = nullptr;
+		const node* targets = nullptr;
+		const edgeweight* weights = nullptr;
+		const edgeid* ids = nullptr;
+	};
+	auto readSections = [&](uint64_t arcs) {
+		Sections s;
+		s.offsets = reinterpret_cast<const index*>(pos);
+		pos += z + 1;
+		s.targets = reinterpret_cast<const node*>(pos);
+		pos += arcs;
+		if (weighted) {
+			s.weights = reinterpret_cast<const edgeweight*>(pos);
+			pos += arcs;
+		}
+		if (indexed) {
+			s.ids = reinterpret_cast<const edgeid*>(pos);
+			pos += arcs;
+		}
+		return s;
+	};
+
+	// a corrupted file must not lead to reads outside of the mapping in later traversals
+	auto validate = [&](const Sections& s, uint64_t arcs) {
+		if (s.offsets[0] != 0 || s.offsets[z] != arcs) {
+			throw std::runtime_error("adjacency offsets do not match the header: " + path);
+		}
+		count decreasing = 0;
+		#pragma omp parallel for reduction(+:decreasing)
+		for (node u = 0; u < z; ++u) {
+			if (s.offsets[u] > s.offsets[u + 1]) {
+				++decreasing;
+			}
+		}
+		if (decreasing > 0) {
+			throw std::runtime_error("adjacency offsets are not monotonic: " + path);
+		}
+		count invalid = 0;
+		count loops = 0;
+		#pragma omp parallel for schedule(guided) reduction(+:invalid,loops)
+		for (node u = 0; u < z; ++u) {
+			if (!exists[u] && s.offsets[u] != s.offsets[u + 1]) {
+				++invalid;
+			}
+			for (index i = s.offsets[u]; i < s.offsets[u + 1]; ++i) {
+				node v = s.targets[i];
+				if (v >= z || !exists[v] || (indexed && s.ids[i] >= header.omega)) {
+					++invalid;
+				}
+				if (v == u) {
+					++loops;
+				}
+			}
+		}
+		if (invalid > 0) {
+			throw std::runtime_error("adjacency arrays contain invalid nodes or edge ids: " + path);
+		}
+		if (loops != header.selfLoops) {
+			throw std::runtime_error("number of self loops does not match the header: " + path);
+		}
+	};
+
+	Sections out = readSections(header.outArcs);
+	validate(out, header.outArcs);
+	Sections in;
+	if (directed) {
+		in = readSections(header.inArcs);
+		validate(in, header.inArcs);
+	}
+
+	return CSRGraph(z, header.m, header.selfLoops, header.omega, weighted, directed, std::move(exists),
+		out.offsets, out.targets, out.weights, out.ids, in.offsets, in.targets, in.weights, in.ids, std::move(file));
+}
+
+} /* namespace NetworKit */
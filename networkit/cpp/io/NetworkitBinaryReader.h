@@ -0,0 +1,45 @@
+/*
+ * NetworkitBinaryReader.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef NETWORKITBINARYREADER_H_
+#define NETWORKITBINARYREADER_H_
+
+#include <string>
+
+#include "GraphReader.h"
+#include "../graph/CSRGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads graphs in the native NetworKit binary format written by NetworkitBinaryWriter.
+ *
+ * readCSR() maps the file into memory and returns a CSRGraph whose arrays point directly into the mapping,
+ * so loading costs no parsing and no copying; pages are only brought in when they are accessed. The mapping
+ * lives as long as the returned CSRGraph. read() builds a regular Graph from the same data.
+ */
+class NetworkitBinaryReader: public GraphReader {
+
+public:
+
+	/**
+	 * Reads the graph stored at @a path into a Graph.
+	 *
+	 * @param[in]	path	input file path
+	 */
+	virtual Graph read(const std::string& path);
+
+	/**
+	 * Maps the file at @a path into memory and returns a read-only view on it.
+	 *
+	 * @param[in]	path	input file path
+	 */
+	CSRGraph readCSR(const std::string& path);
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYREADER_H_ */
@@ -0,0 +1,70 @@
+/*
+ * NetworkitBinaryWriter.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "NetworkitBinaryWriter.h"
+#include "NetworkitBinaryFormat.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+namespace NetworKit {
+
+void NetworkitBinaryWriter::write(const Graph& G, const std::string& path) {
+	write(CSRGraph(G), path);
+}
+
+void NetworkitBinaryWriter::write(const CSRGraph& G, const std::string& path) {
+	std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+	if (!file) {
+		throw std::runtime_error("could not open file for writing: " + path);
+	}
+
+	NetworkitBinary::Header header;
+	std::copy(NetworkitBinary::magic, NetworkitBinary::magic + 8, header.magic);
+	header.byteOrder = NetworkitBinary::byteOrderMark;
+	header.version = NetworkitBinary::version;
+	header.flags = (G.weighted ? NetworkitBinary::weighted : 0) | (G.directed ? NetworkitBinary::directed : 0)
+		| (G.edgesIndexed ? NetworkitBinary::edgeIds : 0);
+	header.z = G.z;
+	header.n = G.n;
+	header.m = G.m;
+	header.omega = G.omega;
+	header.selfLoops = G.storedNumberOfSelfLoops;
+	header.outArcs = G.outOffsets[G.z];
+	header.inArcs = G.directed ? G.inOffsets[G.z] : 0;
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	std::vector<uint64_t> bitmap((G.z + 63) / 64, 0);
+	for (node u = 0; u < G.z; ++u) {
+		if (G.exists[u]) {
+			bitmap[u / 64] |= uint64_t(1) << (u % 64);
+		}
+	}
+	file.write(reinterpret_cast<const char*>(bitmap.data()), bitmap.size() * sizeof(uint64_t));
+
+	auto writeSections = [&](const index* offsets, const node* targets, const edgeweight* weights, const edgeid* ids) {
+		const count arcs = offsets[G.z];
+		file.write(reinterpret_cast<const char*>(offsets), (G.z + 1) * sizeof(index));
+		file.write(reinterpret_cast<const char*>(targets), arcs * sizeof(node));
+		if (G.weighted) {
+			file.write(reinterpret_cast<const char*>(weights), arcs * sizeof(edgeweight));
+		}
+		if (G.edgesIndexed) {
+			file.write(reinterpret_cast<const char*>(ids), arcs * sizeof(edgeid));
+		}
+	};
+	writeSections(G.outOffsets, G.outTargets, G.outWeights, G.outIds);
+	if (G.directed) {
+		writeSections(G.inOffsets, G.inTargets, G.inWeights, G.inIds);
+	}
+
+	if (!file) {
+		throw std::runtime_error("error while writing file: " + path);
+	}
+}
+
+} /* namespace NetworKit */
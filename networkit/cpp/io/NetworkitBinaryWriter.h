@@ -0,0 +1,44 @@
+/*
+ * NetworkitBinaryWriter.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef NETWORKITBINARYWRITER_H_
+#define NETWORKITBINARYWRITER_H_
+
+#include <string>
+
+#include "GraphWriter.h"
+#include "../graph/CSRGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes graphs in the native NetworKit binary format, a versioned header followed by the CSR arrays of the
+ * graph (see NetworkitBinaryFormat.h). Such files are loaded without parsing by NetworkitBinaryReader.
+ */
+class NetworkitBinaryWriter: public GraphWriter {
+
+public:
+
+	/**
+	 * Writes @a G to the file at @a path.
+	 *
+	 * @param[in]	G	graph
+	 * @param[in]	path	output file path
+	 */
+	virtual void write(const Graph& G, const std::string& path);
+
+	/**
+	 * Writes the CSR graph @a G to the file at @a path.
+	 *
+	 * @param[in]	G	graph
+	 * @param[in]	path	output file path
+	 */
+	void write(const CSRGraph& G, const std::string& path);
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYWRITER_H_ */
@@ -10,6 +10,7 @@
 #include "IOGTest.h"
 
 #include <fstream>
+#include <limits>
 #include <unordered_set>
 #include <vector>
 
@@ -32,6 +33,8 @@
 #include "../GMLGraphReader.h"
 #include "../GraphToolBinaryReader.h"
 #include "../GraphToolBinaryWriter.h"
+#include "../NetworkitBinaryReader.h"
+#include "../NetworkitBinaryWriter.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 
 #include "../../community/GraphClusteringTools.h"
@@ -387,6 +390,64 @@ TEST_F(IOGTest, testEdgeListReader) {
 
 }
 
+TEST_F(IOGTest, testEdgeListReaderParallelChunks) {
+	// enough lines for many chunks; comments, carriage returns and duplicate edges in both directions
+	Graph G = ErdosRenyiGenerator(300, 0.05).generate();
+	std::string path = "output/chunks.edgelist";
+	std::vector<std::string> labelsInOrder;
+	{
+		std::ofstream file(path);
+		file << "# comment at the start\n";
+		count line = 0;
+		G.forEdges([&](node u, node v) {
+			file << (u + 1) << " " << (v + 1) << ((line % 3 == 0) ? "\r\n" : "\n");
+			if (line % 7 == 0) {
+				file << "# comment\n" << (v + 1) << " " << (u + 1) << "\n";
+			}
+			++line;
+		});
+	}
+
+	EdgeListReader reader(' ', 1);
+	Graph G2 = reader.read(path);
+	EXPECT_EQ(G.upperNodeIdBound(), G2.upperNodeIdBound());
+	EXPECT_EQ(G.numberOfEdges(), G2.numberOfEdges());
+	G.forEdges([&](node u, node v) {
+		EXPECT_TRUE(G2.hasEdge(u, v));
+	});
+
+	// non-continuous ids are assigned in order of first appearance in the file
+	EdgeListReader nonContinuousReader(' ', 1, "#", false);
+	Graph G3 = nonContinuousReader.read(path);
+	EXPECT_EQ(G.numberOfEdges(), G3.numberOfEdges());
+	std::map<std::string, node> map = nonContinuousReader.getNodeMap();
+	node expectedId = 0;
+	std::vector<bool> seen(G.upperNodeIdBound(), false);
+	G.forEdges([&](node u, node v) {
+		for (node w : {u, v}) {
+			if (!seen[w]) {
+				seen[w] = true;
+				EXPECT_EQ(expectedId++, map[std::to_string(w + 1)]);
+			}
+		}
+	});
+	G.forEdges([&](node u, node v) {
+		EXPECT_TRUE(G3.hasEdge(map[std::to_string(u + 1)], map[std::to_string(v + 1)]));
+	});
+
+	// malformed lines are reported with their line number
+	{
+		std::ofstream file(path);
+		file << "1 2\n# comment\n2 3 4 5\n";
+	}
+	try {
+		reader.read(path);
+		FAIL() << "malformed line was not detected";
+	} catch (std::runtime_error& e) {
+		EXPECT_EQ(std::string("malformed line 3: 2 3 4 5"), e.what());
+	}
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
 	EdgeListPartitionReader reader(1);
 
@@ -407,7 +468,7 @@ TEST_F(IOGTest, testEdgeListCoverReader) {
 	Cover zeta = reader.read("input/LFR-generator-example/community_overlapping.dat", G);
 	EXPECT_EQ(9u, zeta.upperBound());
 	EXPECT_EQ(10u, zeta.numberOfElements());
-	EXPECT_EQ(1u, zeta[0].count(1));
+	EXPECT_TRUE(zeta.inSubset(1, 0));
 	EXPECT_EQ(3u, zeta[0].size());
 	EXPECT_EQ(1u, zeta[3].size());
 }
@@ -420,7 +481,7 @@ TEST_F(IOGTest, testCoverReader) {
 	Cover zeta = reader.read("input/LFR-generator-example/community_overlapping.cover", G);
 	EXPECT_EQ(9u, zeta.upperBound());
 	EXPECT_EQ(10u, zeta.numberOfElements());
-	EXPECT_EQ(1u, zeta[0].count(1));
+	EXPECT_TRUE(zeta.inSubset(1, 0));
 	EXPECT_EQ(3u, zeta[0].size());
 	EXPECT_EQ(1u, zeta[3].size());
 }
@@ -439,7 +500,7 @@ TEST_F(IOGTest, testCoverWriter) {
 	Cover read = reader.read(outpath, G);
 	EXPECT_EQ(9u, read.upperBound());
 	EXPECT_EQ(10u, read.numberOfElements());
-	EXPECT_EQ(1u, read[0].count(1));
+	EXPECT_TRUE(read.inSubset(1, 0));
 	EXPECT_EQ(3u, read[0].size());
 	EXPECT_EQ(1u, read[3].size());
 }
@@ -628,6 +689,104 @@ TEST_F(IOGTest, testGraphToolBinaryReader) {
 	EXPECT_FALSE(G.isDirected());
 }
 
+TEST_F(IOGTest, testNetworkitBinaryWriterAndReader) {
+	for (bool directed : {false, true}) {
+		Graph G(ErdosRenyiGenerator(200, 0.05, directed).generate(), true, directed);
+		G.forEdges([&](node u, node v) {
+			G.setWeight(u, v, 0.5 * (u + v));
+		});
+		G.forNeighborsOf(7, [&](node v) {
+			G.removeEdge(7, v);
+		});
+		if (directed) {
+			G.forInNeighborsOf(7, [&](node u) {
+				G.removeEdge(u, 7);
+			});
+		}
+		G.removeNode(7);
+		G.indexEdges();
+
+		std::string path = "output/test.nkbg";
+		NetworkitBinaryWriter writer;
+		writer.write(G, path);
+
+		NetworkitBinaryReader reader;
+		CSRGraph C = reader.readCSR(path);
+		EXPECT_EQ(G.numberOfNodes(), C.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), C.numberOfEdges());
+		EXPECT_EQ(G.upperNodeIdBound(), C.upperNodeIdBound());
+		EXPECT_EQ(G.upperEdgeIdBound(), C.upperEdgeIdBound());
+		EXPECT_EQ(G.isDirected(), C.isDirected());
+		EXPECT_TRUE(C.isWeighted());
+		EXPECT_TRUE(C.hasEdgeIds());
+		EXPECT_FALSE(C.hasNode(7));
+		G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+			EXPECT_TRUE(C.hasEdge(u, v));
+			EXPECT_EQ(w, C.weight(u, v));
+			EXPECT_EQ(eid, C.edgeId(u, v));
+		});
+		G.forNodes([&](node u) {
+			EXPECT_EQ(G.degreeIn(u), C.degreeIn(u));
+		});
+
+		Graph G2 = reader.read(path);
+		EXPECT_EQ(G.numberOfNodes(), G2.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), G2.numberOfEdges());
+		EXPECT_EQ(G.totalEdgeWeight(), G2.totalEdgeWeight());
+	}
+
+	// files of other formats are rejected
+	NetworkitBinaryReader reader;
+	EXPECT_THROW(reader.readCSR("input/power.gt"), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNetworkitBinaryReaderRejectsCorruptedFiles) {
+	Graph G(10);
+	for (node u = 0; u < 9; ++u) {
+		G.addEdge(u, u + 1);
+	}
+	G.addEdge(3, 3);
+	std::string path = "output/corrupted.nkbg";
+	NetworkitBinaryWriter writer;
+	writer.write(G, path);
+	NetworkitBinaryReader reader;
+	EXPECT_EQ(1u, reader.readCSR(path).numberOfSelfLoops());
+
+	// header, one word of the exists bitmap, 11 offsets, then the targets
+	const std::streamoff offsets = 88 + 8;
+	const std::streamoff targets = offsets + 11 * 8;
+	auto overwrite = [&](std::streamoff position, uint64_t value) {
+		writer.write(G, path);
+		std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+		file.seekp(position);
+		file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	};
+	overwrite(targets, 1000); // target out of range
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+	overwrite(offsets + 2 * 8, 100); // offsets not monotonic
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+	overwrite(offsets, 1); // first offset not 0
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+	overwrite(64, 0); // number of self loops in the header
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+	overwrite(48, 11); // number of edges in the header
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+	overwrite(32, std::numeric_limits<uint64_t>::max()); // z + 1 wraps around
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+
+	// for weighted graphs, doubling a huge arc count would wrap around to the real size of the file
+	Graph W(G, true, false);
+	writer.write(W, path);
+	EXPECT_EQ(G.numberOfEdges(), reader.readCSR(path).numberOfEdges());
+	uint64_t arcs = 2 * G.numberOfEdges() - G.numberOfSelfLoops();
+	std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+	file.seekp(72);
+	arcs += uint64_t(1) << 63;
+	file.write(reinterpret_cast<const char*>(&arcs), sizeof(arcs));
+	file.close();
+	EXPECT_THROW(reader.readCSR(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testGraphToolBinaryWriter) {
 	Graph G(10,false,false);
 	G.addEdge(0,1);
@@ -6,8 +6,9 @@
  */
 
 
-#include <set>
+#include <algorithm>
 #include <utility>
+#include <omp.h>
 #include "ApproximatePageRank.h"
 
 namespace NetworKit {
@@ -18,47 +19,116 @@ ApproximatePageRank::ApproximatePageRank(const Graph& g, double alpha_, double e
 
 }
 
-void ApproximatePageRank::push(node u, std::set<node>& activeNodes)
-{
-	double res = pr_res[u].second;
-	double mass = oneMinusAlphaOver2 * res / G.degree(u);
+void ApproximatePageRank::compute(node seed, Workspace& ws, std::vector<std::pair<node, double>>& result) const {
+	const count z = G.upperNodeIdBound();
+	if (ws.pr.size() < z) {
+		ws.pr.assign(z, 0.0);
+		ws.residual.assign(z, 0.0);
+		ws.queued.assign(z, false);
+		ws.seen.assign(z, false);
+	}
 
-	G.forNeighborsOf(u, [&](node v) {
-		if (pr_res.find(v) == pr_res.end()) {
-			pr_res[v] = std::pair<double, double>(0.0, 0.0);
+	auto touch = [&](node v) {
+		if (!ws.seen[v]) {
+			ws.seen[v] = true;
+			ws.touched.push_back(v);
 		}
-		pr_res[v] = std::pair<double, double>(pr_res[v].first, pr_res[v].second + mass);
-		if ((pr_res[v].second / G.degree(v)) >= eps) {
-			activeNodes.insert(v);
+	};
+	auto activate = [&](node v) {
+		if (!ws.queued[v] && ws.residual[v] / G.degree(v) >= eps) {
+			ws.queued[v] = true;
+			ws.queue.push_back(v);
 		}
-	});
+	};
+
+	touch(seed);
+	ws.residual[seed] = 1.0;
+	ws.queued[seed] = true;
+	ws.queue.push_back(seed);
 
-	pr_res[u] = std::pair<double, double>(pr_res[u].first + alpha * res, oneMinusAlphaOver2 * res);
-	if ((pr_res[u].second / G.degree(u)) >= eps) {
-		activeNodes.insert(u);
+	// FIFO order, the queue vector is only cleared at the end
+	for (index head = 0; head < ws.queue.size(); ++head) {
+		node u = ws.queue[head];
+		ws.queued[u] = false;
+		double res = ws.residual[u];
+		count deg = G.degree(u);
+		if (deg == 0) { // the lazy walk stays at u forever
+			ws.pr[u] += res;
+			ws.residual[u] = 0.0;
+			continue;
+		}
+		double mass = oneMinusAlphaOver2 * res / deg;
+		G.forNeighborsOf(u, [&](node v) {
+			touch(v);
+			ws.residual[v] += mass;
+			activate(v);
+		});
+		ws.pr[u] += alpha * res;
+		ws.residual[u] = oneMinusAlphaOver2 * res;
+		activate(u);
 	}
-}
 
+	result.reserve(result.size() + ws.touched.size());
+	for (node v : ws.touched) {
+		result.emplace_back(v, ws.pr[v]);
+		ws.pr[v] = 0.0;
+		ws.residual[v] = 0.0;
+		ws.seen[v] = false;
+	}
+	ws.touched.clear();
+	ws.queue.clear();
+}
 
 std::vector<std::pair<node, double>> ApproximatePageRank::run(node seed) {
-	pr_res[seed] = std::pair<double, double>(0.0, 1.0);
-	std::set<node> activeNodes;
-	activeNodes.insert(seed);
-
-	while (activeNodes.size() > 0) {
-		node v = (* activeNodes.begin());
-		activeNodes.erase(v);
-		TRACE("queue size: ", activeNodes.size());
-		push(v, activeNodes);
+	if (workspaces.empty()) {
+		workspaces.resize(1);
 	}
-
 	std::vector<std::pair<node, double>> pr;
+	compute(seed, workspaces[0], pr);
+	return pr;
+}
 
-	for (std::unordered_map<node, std::pair<double, double>>::iterator it = pr_res.begin(); it != pr_res.end(); it++) {
-		pr.push_back(std::pair<node, double>(it->first, it->second.first));
+ApproximatePageRank::BatchResult ApproximatePageRank::runBatch(const std::vector<node>& seeds, count k) {
+	const count threads = omp_get_max_threads();
+	if (workspaces.size() < threads) {
+		workspaces.resize(threads);
 	}
+	std::vector<std::vector<std::pair<node, double>>> localEntries(threads);
+	// position of the entries of every seed in the thread-local buffers
+	std::vector<index> owner(seeds.size());
+	std::vector<index> begin(seeds.size());
 
-	return pr;
+	BatchResult result;
+	result.offsets.assign(seeds.size() + 1, 0);
+
+	#pragma omp parallel for schedule(dynamic)
+	for (index i = 0; i < seeds.size(); ++i) {
+		index t = omp_get_thread_num();
+		std::vector<std::pair<node, double>>& entries = localEntries[t];
+		owner[i] = t;
+		begin[i] = entries.size();
+		compute(seeds[i], workspaces[t], entries);
+		if (k != none) {
+			auto first = entries.begin() + begin[i];
+			auto middle = first + std::min(k, (count) (entries.end() - first));
+			std::partial_sort(first, middle, entries.end(), [](const std::pair<node, double>& a, const std::pair<node, double>& b) {
+				return a.second > b.second;
+			});
+			entries.erase(middle, entries.end());
+		}
+		result.offsets[i + 1] = entries.size() - begin[i];
+	}
+
+	for (index i = 0; i < seeds.size(); ++i) {
+		result.offsets[i + 1] += result.offsets[i];
+	}
+	result.entries.resize(result.offsets.back());
+	#pragma omp parallel for schedule(guided)
+	for (index i = 0; i < seeds.size(); ++i) {
+		auto first = localEntries[owner[i]].begin() + begin[i];
+		std::copy(first, first + (result.offsets[i + 1] - result.offsets[i]), result.entries.begin() + result.offsets[i]);
+	}
+	return result;
 }
 
 } /* namespace NetworKit */
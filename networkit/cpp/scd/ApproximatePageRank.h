@@ -9,24 +9,54 @@
 #define APPROXIMATEPAGERANK_H_
 
 #include <vector>
-#include <unordered_map>
 #include "../graph/Graph.h"
 
 namespace NetworKit {
 
 /**
  * Computes an approximate PageRank vector from a given seed.
+ *
+ * The push algorithm keeps its estimates and residuals in dense arrays, which are reset only at the touched
+ * nodes, so the cost of a query is proportional to the explored part of the graph. runBatch() answers many
+ * queries in parallel with one such workspace per thread. The workspaces are kept by the object and reused
+ * by later calls, so run() and runBatch() must not be called concurrently on the same object.
  */
 class ApproximatePageRank {
+public:
+	/**
+	 * Approximate PageRank vectors of several seeds in compressed sparse row format: the entries of seed
+	 * @a i are <code>entries[offsets[i]]</code> to <code>entries[offsets[i+1]-1]</code>.
+	 */
+	struct BatchResult {
+		std::vector<index> offsets; //!< size number of seeds + 1
+		std::vector<std::pair<node, double>> entries; //!< (node, approximate PageRank) pairs
+	};
+
 protected:
 	const Graph& G;
 	double alpha;
 	double oneMinusAlphaOver2;
 	double eps;
 
-	std::unordered_map<node, std::pair<double, double>> pr_res;
+	/**
+	 * Reusable state of one push computation.
+	 */
+	struct Workspace {
+		std::vector<double> pr;
+		std::vector<double> residual;
+		std::vector<bool> queued;
+		std::vector<bool> seen;
+		std::vector<node> touched; // nodes with a nonzero residual or estimate so far
+		std::vector<node> queue;
+	};
 
-	void push(node u, std::set<node>& activeNodes);
+	std::vector<Workspace> workspaces; // one per thread, allocated on first use
+
+	/**
+	 * Runs the push algorithm from @a seed and writes the (node, estimate) pairs of all touched nodes
+	 * to @a result. Afterwards the workspace is clean again.
+	 */
+	void compute(node seed, Workspace& ws, std::vector<std::pair<node, double>>& result) const;
 
 public:
 	/**
@@ -41,6 +71,16 @@ public:
 	 *         specified in the constructor.
 	 */
 	std::vector<std::pair<node, double>> run(node seed);
+
+	/**
+	 * Computes the approximate PageRank vectors of all @a seeds in parallel.
+	 *
+	 * @param seeds The seed nodes, one query per entry.
+	 * @param k If not none, only the @a k nodes with the highest approximate PageRank are kept per seed,
+	 *          in descending order of the PageRank. Otherwise all nodes reached from the seed are returned.
+	 * @return The approximate PageRank vectors in the order of @a seeds.
+	 */
+	BatchResult runBatch(const std::vector<node>& seeds, count k = none);
 };
 
 } /* namespace NetworKit */
@@ -98,12 +98,23 @@ std::set<node> PageRankNibble::expandSeed(node seed) {
 }
 
 std::map<node, std::set<node> >  PageRankNibble::run(std::set<unsigned int>& seeds) {
-    std::map<node, std::set<node> > result;
-	for (auto seed : seeds) {
-		auto community = expandSeed(seed);
-		result[seed] = community;
+	// all PageRank vectors are computed in one parallel batch, the sweeps run in parallel afterwards
+	std::vector<node> seedVector(seeds.begin(), seeds.end());
+	ApproximatePageRank apr(G, alpha, epsilon);
+	ApproximatePageRank::BatchResult prs = apr.runBatch(seedVector);
+
+	std::vector<std::set<node>> communities(seedVector.size());
+	#pragma omp parallel for schedule(dynamic)
+	for (index i = 0; i < seedVector.size(); ++i) {
+		std::vector<std::pair<node, double>> pr(prs.entries.begin() + prs.offsets[i], prs.entries.begin() + prs.offsets[i + 1]);
+		communities[i] = bestSweepSet(pr);
+	}
+
+	std::map<node, std::set<node> > result;
+	for (index i = 0; i < seedVector.size(); ++i) {
+		result[seedVector[i]] = std::move(communities[i]);
 	}
-    return result;
+	return result;
 }
 
 } /* namespace NetworKit */
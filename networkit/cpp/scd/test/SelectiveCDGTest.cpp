@@ -1,6 +1,7 @@
 #include "SelectiveCDGTest.h"
 
 #include "../PageRankNibble.h"
+#include "../ApproximatePageRank.h"
 #include "../../community/Modularity.h"
 #include "../../community/Conductance.h"
 #include "../../graph/Graph.h"
@@ -46,6 +47,41 @@ TEST_F(SCDGTest2, testPageRankNibble) {
 	INFO("Conductance of PR-Nibble: ", cond, "; cluster size: ", cluster.size());
 }
 
+TEST_F(SCDGTest2, testApproximatePageRankBatch) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	double alpha = 0.1;
+	double epsilon = 1e-6;
+	std::vector<node> seeds = {0, 5, 17, 42, 100, 5};
+	count k = 10;
+
+	ApproximatePageRank apr(G, alpha, epsilon);
+	ApproximatePageRank::BatchResult all = apr.runBatch(seeds);
+	ApproximatePageRank::BatchResult top = apr.runBatch(seeds, k);
+	ASSERT_EQ(seeds.size() + 1, all.offsets.size());
+	ASSERT_EQ(seeds.size() + 1, top.offsets.size());
+
+	for (index i = 0; i < seeds.size(); ++i) {
+		std::vector<std::pair<node, double>> single = apr.run(seeds[i]);
+		std::vector<std::pair<node, double>> batch(all.entries.begin() + all.offsets[i], all.entries.begin() + all.offsets[i + 1]);
+		EXPECT_EQ(single, batch);
+
+		double sum = 0.0;
+		for (auto entry : single) {
+			sum += entry.second;
+		}
+		EXPECT_LE(sum, 1.0 + 1e-9);
+		EXPECT_GT(sum, 0.9);
+
+		std::sort(single.begin(), single.end(), [](const std::pair<node, double>& a, const std::pair<node, double>& b) {
+			return a.second > b.second;
+		});
+		ASSERT_EQ(std::min(k, (count) single.size()), top.offsets[i + 1] - top.offsets[i]);
+		for (index j = 0; j < top.offsets[i + 1] - top.offsets[i]; ++j) {
+			EXPECT_EQ(single[j].second, top.entries[top.offsets[i] + j].second);
+		}
+	}
+}
 
 } /* namespace NetworKit */
 
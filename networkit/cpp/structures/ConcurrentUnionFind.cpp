@@ -0,0 +1,69 @@
+/*
+ * ConcurrentUnionFind.cpp
+ *
+ *  Created on: 17.10.2016
+ */
+
+#include "ConcurrentUnionFind.h"
+
+namespace NetworKit {
+
+void ConcurrentUnionFind::allToSingletons() {
+	#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		parent[i] = i;
+	}
+}
+
+index ConcurrentUnionFind::find(index u) {
+	index p = __atomic_load_n(&parent[u], __ATOMIC_RELAXED);
+	while (p != u) {
+		index gp = __atomic_load_n(&parent[p], __ATOMIC_RELAXED);
+		if (gp != p) {
+			// path halving, a failed exchange only means another thread has shortened the path already
+			__sync_bool_compare_and_swap(&parent[u], p, gp);
+		}
+		u = p;
+		p = gp;
+	}
+	return u;
+}
+
+void ConcurrentUnionFind::merge(index u, index v) {
+	while (true) {
+		u = find(u);
+		v = find(v);
+		if (u == v) {
+			return;
+		}
+		if (u < v) {
+			std::swap(u, v);
+		}
+		// u is the larger root; hook it below v unless another thread has hooked it meanwhile
+		if (__sync_bool_compare_and_swap(&parent[u], u, v)) {
+			return;
+		}
+	}
+}
+
+void ConcurrentUnionFind::compress() {
+	#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		while (parent[i] != parent[parent[i]]) {
+			parent[i] = parent[parent[i]];
+		}
+	}
+}
+
+Partition ConcurrentUnionFind::toPartition() {
+	compress();
+	Partition p(parent.size());
+	p.setUpperBound(parent.size());
+	#pragma omp parallel for
+	for (index e = 0; e < parent.size(); ++e) {
+		p[e] = parent[e];
+	}
+	return p;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,70 @@
+/*
+ * ConcurrentUnionFind.h
+ *
+ *  Created on: 17.10.2016
+ */
+
+#ifndef CONCURRENTUNIONFIND_H_
+#define CONCURRENTUNIONFIND_H_
+
+#include <vector>
+#include "../Globals.h"
+#include "../structures/Partition.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Union Find data structure which may be used by several threads at once.
+ * Sets are linked by pointing the larger root to the smaller one with a compare-and-swap, so the
+ * representative of a set is always its smallest element. find() shortens paths by halving, which
+ * only ever replaces a parent by one of its ancestors and is thus safe under concurrent merges.
+ */
+class ConcurrentUnionFind {
+private:
+	std::vector<index> parent;
+public:
+
+	/**
+	 * Create a new set representation with not more than @a max_element elements.
+	 * Initially every element is in its own set.
+	 * @param max_element maximum number of elements
+	 */
+	ConcurrentUnionFind(index max_element) : parent(max_element) {
+		allToSingletons();
+	}
+
+	/**
+	 * Assigns every element to a singleton set.
+	 * Set id is equal to element id. Not thread-safe.
+	 */
+	void allToSingletons();
+
+	/**
+	 * Find the representative of element @a u. Thread-safe.
+	 * @param u element
+	 * @return representative of set containing @a u
+	 */
+	index find(index u);
+
+	/**
+	 * Merge the two sets containing @a u and @a v. Thread-safe.
+	 * @param u element u
+	 * @param v element v
+	 */
+	void merge(index u, index v);
+
+	/**
+	 * Points every element directly to its representative. Must not run concurrently with merge().
+	 */
+	void compress();
+
+	/**
+	 * Convert the Union Find data structure to a Partition, the subset ids are the representatives.
+	 * @return Partition equivalent to the union find data structure
+	 */
+	Partition toPartition();
+};
+
+} /* namespace NetworKit */
+#endif /* CONCURRENTUNIONFIND_H_ */
@@ -8,6 +8,7 @@
 #include "Cover.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 
 namespace NetworKit {
@@ -20,10 +21,43 @@ Cover::Cover(index z) : z(z-1), omega(0), data(z) {
 Cover::Cover(const NetworKit::Partition &p) : z(p.numberOfElements()-1), omega(p.upperBound()-1), data(p.numberOfElements()) {
 	p.forEntries([&](index e, index s) {
 		if (s != none)
-			data[e].insert(s);
+			data[e].push_back(s);
 	});
 }
 
+Cover::Cover(index z, const std::vector<std::vector<index>>& subsets) : z(z-1), omega(subsets.empty() ? 0 : subsets.size()-1), data(z) {
+	// count the memberships of every element to allocate the exact space
+	std::vector<std::atomic<count>> memberships(z);
+	#pragma omp parallel for
+	for (index e = 0; e < z; ++e) {
+		memberships[e] = 0;
+	}
+	#pragma omp parallel for schedule(guided)
+	for (index s = 0; s < subsets.size(); ++s) {
+		for (index e : subsets[s]) {
+			assert (e < z);
+			memberships[e].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	#pragma omp parallel for
+	for (index e = 0; e < z; ++e) {
+		data[e].resize(memberships[e]);
+		memberships[e] = 0;
+	}
+
+	#pragma omp parallel for schedule(guided)
+	for (index s = 0; s < subsets.size(); ++s) {
+		for (index e : subsets[s]) {
+			data[e][memberships[e].fetch_add(1, std::memory_order_relaxed)] = s;
+		}
+	}
+	#pragma omp parallel for schedule(guided)
+	for (index e = 0; e < z; ++e) {
+		std::sort(data[e].begin(), data[e].end());
+		data[e].erase(std::unique(data[e].begin(), data[e].end()), data[e].end());
+	}
+}
+
 bool Cover::contains(index e) const {
 	return (e <= z) && (! data[e].empty());	// e is in the element index range and the entry is not empty
 }
@@ -33,49 +67,98 @@ bool Cover::inSameSubset(index e1, index e2) const {
 	assert (e2 <= z);
 	assert (! data[e1].empty());
 	assert (! data[e2].empty()); // elements cannot be unassigned - it may be possible to change this behavior
-	std::set<index> intersect;
-	std::set_intersection(data[e1].begin(),data[e1].end(),data[e2].begin(), data[e2].end(), std::inserter(intersect,intersect.begin()));
-	return (!intersect.empty());
+	// both lists are sorted, so a merge finds a common subset
+	auto it1 = data[e1].begin();
+	auto it2 = data[e2].begin();
+	while (it1 != data[e1].end() && it2 != data[e2].end()) {
+		if (*it1 < *it2) {
+			++it1;
+		} else if (*it2 < *it1) {
+			++it2;
+		} else {
+			return true;
+		}
+	}
+	return false;
 }
 
 std::set<index> Cover::getMembers(const index s) const {
+	std::vector<index> members = getMemberVector(s);
+	return std::set<index>(members.begin(), members.end());
+}
+
+std::vector<index> Cover::getMemberVector(const index s) const {
 	assert (s <= omega);
-	std::set<index> members;
+	std::vector<index> members;
 	for (index e = 0; e <= this->z; ++e) {
-		for (index t : data[e]) {
-			if (t == s) {
-				members.insert(e);
-			}
+		if (inSubset(s, e)) {
+			members.push_back(e);
 		}
 	}
 	return members;
 }
 
+Cover::MemberIndex Cover::getMemberIndex() const {
+	const index bound = upperBound();
+	MemberIndex result;
+	result.offsets.assign(bound + 1, 0);
+	this->parallelForEntries([&](index e, const std::vector<index>& subsets) {
+		for (index s : subsets) {
+			#pragma omp atomic
+			result.offsets[s + 1]++;
+		}
+	});
+	for (index s = 0; s < bound; ++s) {
+		result.offsets[s + 1] += result.offsets[s];
+	}
+	result.members.resize(result.offsets[bound]);
+
+	std::vector<index> position(result.offsets.begin(), result.offsets.end() - 1);
+	this->parallelForEntries([&](index e, const std::vector<index>& subsets) {
+		for (index s : subsets) {
+			index i;
+			#pragma omp atomic capture
+			i = position[s]++;
+			result.members[i] = e;
+		}
+	});
+	// the parallel insertion scrambles the order within the subsets
+	#pragma omp parallel for schedule(guided)
+	for (index s = 0; s < bound; ++s) {
+		std::sort(result.members.begin() + result.offsets[s], result.members.begin() + result.offsets[s + 1]);
+	}
+	return result;
+}
+
 void Cover::addToSubset(index s, index e) {
 	assert (e <= z);
 	assert (s <= omega);
-	data[e].insert(s);
+	auto it = std::lower_bound(data[e].begin(), data[e].end(), s);
+	if (it == data[e].end() || *it != s) {
+		data[e].insert(it, s);
+	}
 }
 
 void Cover::removeFromSubset(index s, index e) {
 	assert (e <= z);
 	assert (s <= omega);
-	data[e].erase(s);
+	auto it = std::lower_bound(data[e].begin(), data[e].end(), s);
+	if (it != data[e].end() && *it == s) {
+		data[e].erase(it);
+	}
 }
 
 
 void Cover::moveToSubset(index s, index e) {
 	assert (e <= z);
 	assert (s <= omega);
-	data[e].clear();
-	data[e].insert(s);
+	data[e].assign(1, s);
 }
 
 index Cover::toSingleton(index e) {
 	assert (e <= z);
-	data[e].clear();
 	index sid = newSubsetId();
-	data[e].insert(sid);
+	data[e].assign(1, sid);
 	return sid;
 }
 
@@ -90,17 +173,15 @@ void Cover::mergeSubsets(index s, index t) {
 	assert (t <= omega);
 	if ( s != t ) {
 		index m = newSubsetId(); // new id for merged set
+		#pragma omp parallel for
 		for (index e = 0; e <= this->z; ++e) {
-			auto its = data[e].find(s);
-			auto itt = data[e].find(t);
-			if (its != data[e].end()) {
-				data[e].erase(its);
-				data[e].insert(m);
-			}
-			// was else if. makes errors, in case an element is in s as well as t
-			if (itt != data[e].end()) {
-				data[e].erase(itt);
-				data[e].insert(m);
+			std::vector<index>& subsets = data[e];
+			auto end = std::remove_if(subsets.begin(), subsets.end(), [&](index u) {
+				return u == s || u == t;
+			});
+			if (end != subsets.end()) {
+				subsets.erase(end, subsets.end());
+				subsets.insert(std::lower_bound(subsets.begin(), subsets.end(), m), m);
 			}
 		}
 	}
@@ -114,33 +195,33 @@ index Cover::lowerBound() const {
 	return 0;
 }
 
+std::vector<count> Cover::subsetSizesById() const {
+	std::vector<count> sizes(upperBound(), 0);
+	this->parallelForEntries([&](index e, const std::vector<index>& subsets) {
+		for (index s : subsets) {
+			#pragma omp atomic
+			sizes[s]++;
+		}
+	});
+	return sizes;
+}
+
 std::vector<count> Cover::subsetSizes() const {
-	std::map<index,count> mapping;
 	std::vector<count> sizes;
-	count newIndex = 0;
-	for (index e = 0; e <= this->z; ++e) { // stores sizes in a vector
-		for (index t : data[e]) {
-			if (mapping.find(t) == mapping.end()) {
-				mapping[t] = newIndex++;
-				sizes.push_back(1);
-			} else {
-				sizes[mapping[t]]++;
-			}
+	for (count size : subsetSizesById()) {
+		if (size > 0) {
+			sizes.push_back(size);
 		}
-
 	}
 	return sizes;
 }
 
 std::map<index, count> Cover::subsetSizeMap() const {
 	std::map<index,count> sizeMap;
-	for (index e = 0; e <= this->z; ++e) { // stores sizes of subsets in a map
-		for (index t : data[e]) {
-			if (sizeMap.find(t) == sizeMap.end()) {
-				sizeMap[t] = 1;
-			} else {
-				sizeMap[t]++;
-			}
+	std::vector<count> sizes = subsetSizesById();
+	for (index s = 0; s < sizes.size(); ++s) {
+		if (sizes[s] > 0) {
+			sizeMap.emplace_hint(sizeMap.end(), s, sizes[s]);
 		}
 	}
 	return sizeMap;
@@ -149,12 +230,9 @@ std::map<index, count> Cover::subsetSizeMap() const {
 count Cover::numberOfSubsets() const {
 	std::vector<int> exists(upperBound(), 0); // a boolean vector would not be thread-safe
 
-	this->parallelForEntries([&](index e, std::set<index> s) {
-		if (!s.empty()) {
-			for (auto it = s.begin(); it != s.end(); it++) {
-				index currentSubset = *it;
-				exists[currentSubset] = 1;
-			}
+	this->parallelForEntries([&](index e, const std::vector<index>& s) {
+		for (index currentSubset : s) {
+			exists[currentSubset] = 1;
 		}
 	});
 
@@ -179,8 +257,11 @@ void Cover::setUpperBound(index upper) {
 
 std::set<index> Cover::getSubsetIds() const {
 	std::set<index> ids;
-	for (std::set<index> subset : data) {
-		ids.insert(subset.begin(), subset.end());
+	std::vector<count> sizes = subsetSizesById();
+	for (index s = 0; s < sizes.size(); ++s) {
+		if (sizes[s] > 0) {
+			ids.insert(ids.end(), s);
+		}
 	}
 	return ids;
 }
@@ -8,6 +8,7 @@
 #ifndef COVER_H_
 #define COVER_H_
 
+#include <algorithm>
 #include <cinttypes>
 #include <set>
 #include <vector>
@@ -26,6 +27,10 @@ typedef uint64_t count;
  * @ingroup structures
  * Implements a cover of a set, i.e. an assignment of
  * its elements to possibly overlapping subsets.
+ *
+ * The subset ids of every element are stored in a sorted vector, which needs 8 bytes per membership instead
+ * of a tree node per membership. The inverse direction (subset -> elements) is available as a snapshot
+ * from getMemberIndex().
  */
 class Cover {
 
@@ -47,24 +52,27 @@ public:
 	 */
 	Cover(const Partition &p);
 
+	/**
+	 * Creates a new cover data structure from a list of subsets in parallel. Subset @a s gets the id @a s,
+	 * duplicate elements in a subset are ignored.
+	 *
+	 * @param[in]	z	number of elements
+	 * @param[in]	subsets	the members of every subset
+	 */
+	Cover(index z, const std::vector<std::vector<index>>& subsets);
+
 	/** Default destructor */
 	virtual ~Cover() = default;
 
 
 	/**
-	 *  Index operator.
-	 *
-	 *  @param[in]	e	an element
-	 */
-	inline std::set<index>& operator [](const index& e) {
-		return this->data[e];
-	}
-	/**
-	 * Index operator for const instances of this class.
+	 * Index operator. The subsets of an element can only be changed with the methods of this class,
+	 * which keep them sorted.
 	 *
 	 * @param[in]	e	an element
+	 * @return The ids of the subsets in which @a e is contained, in ascending order.
 	 */
-	inline const std::set<index>& operator [](const index& e) const {
+	inline const std::vector<index>& operator [](const index& e) const {
 		return this->data[e];
 	}
 
@@ -76,7 +84,18 @@ public:
 	 */
 	inline std::set<index> subsetsOf(index e) const {
 		// TODO: assert (e < this->numberOfElements());
-		return this->data[e];
+		return std::set<index>(this->data[e].begin(), this->data[e].end());
+	}
+
+	/**
+	 * Check if the element @a e is contained in the subset @a s.
+	 *
+	 * @param[in]	s	a subset
+	 * @param[in]	e	an element
+	 * @return @c true, if @a e is a member of @a s, @c false otherwise.
+	 */
+	inline bool inSubset(index s, index e) const {
+		return std::binary_search(data[e].begin(), data[e].end(), s);
 	}
 
 
@@ -107,6 +126,23 @@ public:
 	 */
 	std::set<index> getMembers(const index s) const;
 
+	/**
+	 * Get the members of a specific subset @a s.
+	 *
+	 * @return The members of subset @a s in ascending order.
+	 */
+	std::vector<index> getMemberVector(const index s) const;
+
+	typedef Partition::MemberIndex MemberIndex;
+
+	/**
+	 * Builds the subset -> elements index in parallel. Use it instead of repeated calls to getMembers(),
+	 * which scan all memberships each time. The index is a snapshot and does not reflect later changes.
+	 *
+	 * @return The member index of this cover, with upperBound()+1 offsets.
+	 */
+	MemberIndex getMemberIndex() const;
+
 
 	/**
 	 * Add the (previously unassigned) element @a e to the set @a s.
@@ -219,7 +255,7 @@ public:
 	/**
 	 * Iterate over all entries (node, subset ID of node) and execute callback function @a func (lambda closure).
 	 *
-	 * @param func Takes parameters <code>(node, index)</code>
+	 * @param func Takes parameters <code>(node, const std::vector<index>&)</code>
 	 */
 	template<typename Callback> void forEntries(Callback func) const;
 
@@ -227,7 +263,7 @@ public:
 	/**
 	 * Iterate over all entries (node, subset ID of node) in parallel and execute callback function @a func (lambda closure).
 	 *
-	 * @param func Takes parameters <code>(node, index)</code>
+	 * @param func Takes parameters <code>(node, const std::vector<index>&)</code>
 	 */
 	template<typename Callback> void parallelForEntries(Callback handle) const;
 
@@ -238,7 +274,12 @@ private:
 
 	index z;	//!< maximum element index that can be mapped
 	index omega;	//!< maximum subset index ever assigned
-	std::vector<std::set<index>> data;	//!< data container, indexed by element id, containing set of subset ids
+	std::vector<std::vector<index>> data;	//!< data container, indexed by element id, containing the sorted subset ids
+
+	/**
+	 * Counts the members of every subset id below upperBound() in parallel.
+	 */
+	std::vector<count> subsetSizesById() const;
 
 
 	/**
@@ -6,10 +6,55 @@
  */
 
 #include "Partition.h"
+#include "../auxiliary/Parallel.h"
+
+#include <algorithm>
 #include <atomic>
+#include <omp.h>
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Replaces every value by the sum of the values before it and returns the total. Every thread sums up one
+ * contiguous block, so the work is O(n / threads + threads).
+ */
+count exclusivePrefixSum(std::vector<count>& values) {
+	const count n = values.size();
+	std::vector<count> blockSums;
+	#pragma omp parallel
+	{
+		const count t = omp_get_thread_num();
+		const count threads = omp_get_num_threads();
+		#pragma omp single
+		blockSums.assign(threads + 1, 0);
+
+		const index begin = n * t / threads;
+		const index end = n * (t + 1) / threads;
+		count sum = 0;
+		for (index i = begin; i < end; ++i) {
+			sum += values[i];
+		}
+		blockSums[t + 1] = sum;
+		#pragma omp barrier
+		#pragma omp single
+		for (count i = 1; i <= threads; ++i) {
+			blockSums[i] += blockSums[i - 1];
+		}
+
+		count running = blockSums[t];
+		for (index i = begin; i < end; ++i) {
+			count value = values[i];
+			values[i] = running;
+			running += value;
+		}
+	}
+	return blockSums.back();
+}
+
+} // namespace
+
 Partition::Partition() : z(0), omega(0), data(0) {
 
 }
@@ -80,66 +125,165 @@ count Partition::numberOfSubsets() const {
 }
 
 void Partition::compact(bool useTurbo) {
-	index i = 0;
-	if (!useTurbo) {
-		std::map<index, index> compactingMap; // first index is the old partition index, "value" is the index of the compacted index
-		this->forEntries([&](index e, index s){ // get assigned SubsetIDs and create a map with new IDs
-			if (s!= none) {
-				auto result = compactingMap.insert(std::make_pair(s,i));
-				if (result.second) ++i;
-			}
-		});
-		this->parallelForEntries([&](index e, index s){ // replace old SubsetIDs with the new IDs
+	index bound = subsetIdBound();
+	const bool dense = useTurbo || bound <= 2 * z;
+	std::vector<index> ids; // distinct subset ids, only needed if the id range is large compared to the number of elements
+	if (!dense) {
+		ids.reserve(z);
+		this->forEntries([&](index e, index s) {
 			if (s != none) {
-				data[e] = compactingMap[s];
+				ids.push_back(s);
 			}
 		});
-	} else {
-		std::vector<index> compactingMap(this->upperBound(), none);
-		this->forEntries([&](index e, index s){
-			if (s != none && compactingMap[s] == none) {
-				compactingMap[s] = i++;
-			}
-		});
-		this->parallelForEntries([&](index e, index s){ // replace old SubsetIDs with the new IDs
-			if (s != none) {
-				data[e] = compactingMap[s];
+		Aux::Parallel::sort(ids.begin(), ids.end());
+		ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	}
+	const count slots = dense ? bound : ids.size();
+	auto slotOf = [&](index s) -> index {
+		return dense ? s : std::lower_bound(ids.begin(), ids.end(), s) - ids.begin();
+	};
+
+	// find the first element of every subset
+	std::vector<std::atomic<index>> first(slots);
+	#pragma omp parallel for
+	for (index i = 0; i < slots; ++i) {
+		first[i] = none;
+	}
+	this->parallelForEntries([&](index e, index s) {
+		if (s != none) {
+			std::atomic<index>& f = first[slotOf(s)];
+			index current = f.load();
+			while (e < current && !f.compare_exchange_weak(current, e)) {}
+		}
+	});
+
+	// the new id of a subset is the number of subsets that occur first before it
+	std::vector<count> rank(z, 0);
+	#pragma omp parallel for
+	for (index i = 0; i < slots; ++i) {
+		if (first[i] != none) {
+			rank[first[i]] = 1;
+		}
+	}
+	count k = exclusivePrefixSum(rank);
+	this->parallelForEntries([&](index e, index s) { // replace old SubsetIDs with the new IDs
+		if (s != none) {
+			data[e] = rank[first[slotOf(s)]];
+		}
+	});
+	this->setUpperBound(k);
+}
+
+index Partition::subsetIdBound() const {
+	index maxId = 0;
+	bool assigned = false;
+	#pragma omp parallel for reduction(max:maxId) reduction(||:assigned)
+	for (index e = 0; e < z; ++e) {
+		if (data[e] != none) {
+			maxId = std::max(maxId, data[e]);
+			assigned = true;
+		}
+	}
+	return assigned ? std::max(upperBound(), maxId + 1) : upperBound();
+}
+
+std::vector<count> Partition::subsetSizesById() const {
+	std::vector<count> sizes(subsetIdBound(), 0);
+	this->parallelForEntries([&](index e, index s) {
+		if (s != none) {
+			#pragma omp atomic
+			sizes[s]++;
+		}
+	});
+	return sizes;
+}
+
+std::vector<std::pair<index, count>> Partition::nonEmptySubsetSizes() const {
+	std::vector<std::pair<index, count>> result;
+	if (subsetIdBound() <= 2 * z) {
+		std::vector<count> sizes = this->subsetSizesById();
+		for (index s = 0; s < sizes.size(); ++s) {
+			if (sizes[s] > 0) {
+				result.emplace_back(s, sizes[s]);
 			}
-		});
+		}
+		return result;
 	}
-	this->setUpperBound(i);
+	// sparse id range: sort the assigned ids instead of counting into a vector indexed by id
+	std::vector<index> ids;
+	ids.reserve(z);
+	this->forEntries([&](index e, index s) {
+		if (s != none) {
+			ids.push_back(s);
+		}
+	});
+	Aux::Parallel::sort(ids.begin(), ids.end());
+	for (index i = 0; i < ids.size(); ) {
+		index j = i;
+		while (j < ids.size() && ids[j] == ids[i]) {
+			++j;
+		}
+		result.emplace_back(ids[i], j - i);
+		i = j;
+	}
+	return result;
 }
 
 std::vector<count> Partition::subsetSizes() const {
 	std::vector<count> sizes;
-	std::map<index, count> map = this->subsetSizeMap();
-	for (auto kv : map) {
-		sizes.push_back(kv.second);
+	for (auto& idAndSize : this->nonEmptySubsetSizes()) {
+		sizes.push_back(idAndSize.second);
 	}
 	return sizes;
 }
 
 std::map<index, count> Partition::subsetSizeMap() const {
 	std::map<index, count> subset2size;
-
-	this->forEntries([&](index e, index s){
-		if (s != none) {
-			subset2size[s] += 1;
-		}
-	});
-
+	for (auto& idAndSize : this->nonEmptySubsetSizes()) {
+		subset2size.emplace_hint(subset2size.end(), idAndSize.first, idAndSize.second);
+	}
 	return subset2size;
 }
 
 std::set<index> Partition::getMembers(const index s) const {
+	std::vector<index> members = getMemberVector(s);
+	return std::set<index>(members.begin(), members.end());
+}
+
+std::vector<index> Partition::getMemberVector(const index s) const {
 	assert (s <= omega);
-	std::set<index> subset;
+	std::vector<index> members;
 	for (index e = 0; e < this->z; ++e) {
 		if (data[e] == s) {
-			subset.insert(e);
+			members.push_back(e);
 		}
 	}
-	return subset;
+	return members;
+}
+
+Partition::MemberIndex Partition::getMemberIndex() const {
+	MemberIndex result;
+	result.offsets = this->subsetSizesById();
+	result.offsets.push_back(0);
+	count assigned = exclusivePrefixSum(result.offsets);
+	result.members.resize(assigned);
+
+	std::vector<index> position(result.offsets.begin(), result.offsets.end() - 1);
+	this->parallelForEntries([&](index e, index s) {
+		if (s != none) {
+			index i;
+			#pragma omp atomic capture
+			i = position[s]++;
+			result.members[i] = e;
+		}
+	});
+	// the parallel insertion scrambles the order within the subsets
+	const count bound = result.offsets.size() - 1;
+	#pragma omp parallel for schedule(guided)
+	for (index s = 0; s < bound; ++s) {
+		std::sort(result.members.begin() + result.offsets[s], result.members.begin() + result.offsets[s + 1]);
+	}
+	return result;
 }
 
 std::vector<index> Partition::getVector() const {
@@ -171,11 +315,14 @@ void Partition::allToOnePartition() {
 }
 
 std::set<index> Partition::getSubsetIds() const {
-	std::set<index> ids;
-	for (index id : data) {
-		if (id != none) {
-			ids.insert(id);
-		}
+	std::vector<index> ids = getSubsetIdVector();
+	return std::set<index>(ids.begin(), ids.end());
+}
+
+std::vector<index> Partition::getSubsetIdVector() const {
+	std::vector<index> ids;
+	for (auto& idAndSize : this->nonEmptySubsetSizes()) {
+		ids.push_back(idAndSize.first);
 	}
 	return ids;
 }
@@ -201,9 +201,11 @@ public:
 	}
 
 	/**
-	 * Change subset IDs to be consecutive, starting at 0.
-	 * @param useTurbo Default: false. If set to true, a vector instead of a map to assign new ids 
-	 * which results in a shorter running time but possibly a large space overhead.
+	 * Change subset IDs to be consecutive, starting at 0. The new ids are assigned in the order in which
+	 * the subsets first occur in the element range. Runs in parallel.
+	 * @param useTurbo Default: false. If set to true, the old ids are always looked up in a vector of size upperBound().
+	 * Otherwise, this is only done if upperBound() is not much larger than the number of elements, and the distinct ids
+	 * are sorted and searched instead, which avoids the space overhead for sparse id ranges.
 	 */
 	void compact(bool useTurbo = false);
 
@@ -257,6 +259,49 @@ public:
 	 */
 	std::set<index> getMembers(const index s) const;
 
+	/**
+	 * Get the members of the subset @a s in ascending order.
+	 *
+	 * @param s The subset.
+	 * @return A vector containing the members of @a s.
+	 */
+	std::vector<index> getMemberVector(const index s) const;
+
+	/**
+	 * Inverse index of a partition in compressed sparse row format: the members of subset @a s are
+	 * <code>members[offsets[s]]</code> to <code>members[offsets[s+1]-1]</code>, in ascending order.
+	 * The index is a snapshot and does not reflect later changes of the partition.
+	 */
+	struct MemberIndex {
+		std::vector<index> offsets; //!< one entry per subset id, plus one
+		std::vector<index> members; //!< all assigned elements, grouped by subset
+
+		/**
+		 * @return The number of members of subset @a s.
+		 */
+		inline count size(index s) const {
+			return offsets[s + 1] - offsets[s];
+		}
+
+		/**
+		 * Calls @a handle(e) for all members @a e of subset @a s in ascending order.
+		 */
+		template<typename L> void forMembers(index s, L handle) const {
+			for (index i = offsets[s]; i < offsets[s + 1]; ++i) {
+				handle(members[i]);
+			}
+		}
+	};
+
+	/**
+	 * Builds the subset -> members index in parallel in O(z log z + upperBound()) time. Use it instead of
+	 * repeated calls to getMembers(), which scan all elements each time. Since the offsets are indexed by
+	 * subset id, the index needs memory in the size of the largest id; compact() partitions with sparse ids first.
+	 *
+	 * @return The member index of this partition.
+	 */
+	MemberIndex getMemberIndex() const;
+
 
 	/**
 	 * @return number of elements in the partition.
@@ -293,6 +338,13 @@ public:
 	 */
 	std::set<index> getSubsetIds() const;
 
+	/**
+	 * Get the ids of nonempty subsets.
+	 *
+	 * @return A vector of the ids of nonempty subsets in ascending order.
+	 */
+	std::vector<index> getSubsetIdVector() const;
+
 	/**
 	 * Set a human-readable identifier @a name for the instance.
 	 *
@@ -333,6 +385,23 @@ private:
 	std::vector<index> data;  	//!< data container, indexed by element index, containing subset index
 	std::string name;
 
+	/**
+	 * @return One more than the largest assigned subset id, but at least upperBound().
+	 */
+	index subsetIdBound() const;
+
+	/**
+	 * Counts the members of every subset id below subsetIdBound() in parallel.
+	 */
+	std::vector<count> subsetSizesById() const;
+
+	/**
+	 * Returns the (id, size) pairs of all non-empty subsets in ascending order of ids. Counts into a vector
+	 * indexed by id if the id range is not much larger than the number of elements, as compact() does, and
+	 * sorts the assigned ids otherwise, so that sparse ids do not cost memory in the size of the largest id.
+	 */
+	std::vector<std::pair<index, count>> nonEmptySubsetSizes() const;
+
 	/**
 	 * Allocates and returns a new subset id.
 	 */
@@ -76,7 +76,7 @@ TEST_F(CoverGTest, testToSingleton) {
 	std::set<index> controlSet2;
 	controlSet2.insert(1);
 	DEBUG("c[0] ", c[0], " and controlSet2 ", controlSet2);
-	EXPECT_TRUE(c[0] == controlSet2);
+	EXPECT_TRUE(c.subsetsOf(0) == controlSet2);
 	c.addToSubset(5,0);
 	c.addToSubset(2,0);
 	c.addToSubset(3,0);
@@ -86,7 +86,7 @@ TEST_F(CoverGTest, testToSingleton) {
 	std::set<index> controlSet;
 	controlSet.insert(11);
 	DEBUG("c[0] ", c[0], " and controlSet ", controlSet);
-	EXPECT_TRUE(c[0] == controlSet);
+	EXPECT_TRUE(c.subsetsOf(0) == controlSet);
 }
 
 TEST_F(CoverGTest, testAddToSubset) {
@@ -96,8 +96,8 @@ TEST_F(CoverGTest, testAddToSubset) {
 	c.addToSubset(0,1);
 	std::set<index> controlSet = {0};
 	EXPECT_TRUE(c.inSameSubset(0,1));
-	EXPECT_TRUE(c[0] == controlSet);
-	EXPECT_TRUE(c[1] == controlSet);
+	EXPECT_TRUE(c.subsetsOf(0) == controlSet);
+	EXPECT_TRUE(c.subsetsOf(1) == controlSet);
 }
 
 
@@ -120,7 +120,7 @@ TEST_F(CoverGTest, testMoveToSubset) {
 	c.addToSubset(0,1);
 	c.moveToSubset(8,0);
 	std::set<index> controlSet = {8};
-	EXPECT_EQ(c[0],controlSet);
+	EXPECT_EQ(c.subsetsOf(0),controlSet);
 }
 
 TEST_F(CoverGTest, testSubsetSizesWithUnassignedElements) {
@@ -293,6 +293,36 @@ TEST_F(CoverGTest, testInSameSubset) {
 	EXPECT_TRUE(c.inSameSubset(1,5));
 }
 
+TEST_F(CoverGTest, testSubsetListConstructor) {
+	std::vector<std::vector<index>> subsets = {{0, 1, 2}, {2, 3}, {}, {4, 2, 0, 4}};
+	Cover c(6, subsets);
+	EXPECT_EQ(6u, c.numberOfElements());
+	EXPECT_EQ(4u, c.upperBound());
+	EXPECT_EQ(3u, c.numberOfSubsets());
+	EXPECT_EQ(std::vector<index>({0, 1, 3}), c[2]);
+	EXPECT_EQ(std::vector<index>({0, 3}), c[0]);
+	EXPECT_TRUE(c.inSubset(3, 4));
+	EXPECT_FALSE(c.inSubset(1, 4));
+	EXPECT_FALSE(c.contains(5));
+
+	Cover::MemberIndex memberIndex = c.getMemberIndex();
+	ASSERT_EQ(5u, memberIndex.offsets.size());
+	for (index s = 0; s < subsets.size(); ++s) {
+		std::set<index> expected(subsets[s].begin(), subsets[s].end());
+		std::vector<index> members;
+		memberIndex.forMembers(s, [&](index e) {
+			members.push_back(e);
+		});
+		EXPECT_EQ(std::vector<index>(expected.begin(), expected.end()), members);
+		EXPECT_EQ(members, c.getMemberVector(s));
+		EXPECT_EQ(expected, c.getMembers(s));
+	}
+
+	c.removeFromSubset(0, 2);
+	c.addToSubset(2, 2);
+	EXPECT_EQ(std::vector<index>({1, 2, 3}), c[2]);
+}
+
 
 } /* namespace NetworKit */
 
@@ -6,10 +6,12 @@
  */
 
 #include <iostream>
+#include <limits>
 
 #include "PartitionGTest.h"
 
 #include "../Partition.h"
+#include "../../auxiliary/Random.h"
 
 #ifndef NOGTEST
 
@@ -273,6 +275,87 @@ TEST_F(PartitionGTest, testGetMembers) {
 	}
 }
 
+TEST_F(PartitionGTest, testCompactLargeIdRange) {
+	// few subsets with ids far apart, and some unassigned elements
+	count n = 5000;
+	for (bool turbo : {false, true}) {
+		Partition p(n);
+		p.setUpperBound(100 * n);
+		for (index e = 0; e < n; ++e) {
+			if (e % 7 != 3) {
+				p[e] = Aux::Random::integer(50) * 2 * n;
+			}
+		}
+		Partition original = p;
+		p.compact(turbo);
+
+		// sequential reference: ids in order of first occurrence
+		std::map<index, index> expected;
+		original.forEntries([&](index e, index s) {
+			if (s != none && expected.find(s) == expected.end()) {
+				index next = expected.size();
+				expected[s] = next;
+			}
+		});
+		EXPECT_EQ(expected.size(), p.upperBound());
+		for (index e = 0; e < n; ++e) {
+			if (original[e] == none) {
+				EXPECT_EQ(none, p[e]);
+			} else {
+				EXPECT_EQ(expected[original[e]], p[e]);
+			}
+		}
+	}
+}
+
+TEST_F(PartitionGTest, testSubsetSizesSparseIds) {
+	// ids far beyond the number of elements must not be counted in a vector indexed by id
+	Partition p(6);
+	const index big = std::numeric_limits<index>::max() / 2;
+	p[0] = big;
+	p[1] = 7;
+	p[2] = big;
+	p[4] = big + 3;
+	p[5] = 7;
+
+	std::map<index, count> expected = {{7, 2}, {big, 2}, {big + 3, 1}};
+	EXPECT_EQ(expected, p.subsetSizeMap());
+	EXPECT_EQ(std::vector<count>({2, 2, 1}), p.subsetSizes());
+	EXPECT_EQ(std::set<index>({7, big, big + 3}), p.getSubsetIds());
+	EXPECT_EQ(std::vector<index>({7, big, big + 3}), p.getSubsetIdVector());
+}
+
+TEST_F(PartitionGTest, testGetMemberIndex) {
+	Partition p(10);
+	p.allToSingletons();
+	p.mergeSubsets(p[0],p[9]);
+	p.mergeSubsets(p[1],p[8]);
+	p.mergeSubsets(p[2],p[7]);
+	p.mergeSubsets(p[0],p[1]);
+	p.mergeSubsets(p[1],p[2]);
+	p.remove(5);
+
+	Partition::MemberIndex memberIndex = p.getMemberIndex();
+	ASSERT_EQ(p.upperBound() + 1, memberIndex.offsets.size());
+	EXPECT_EQ(9u, memberIndex.members.size());
+	std::vector<index> membersControl = {0,1,2,7,8,9};
+	std::vector<index> members;
+	memberIndex.forMembers(p[0], [&](index e) {
+		members.push_back(e);
+	});
+	EXPECT_EQ(membersControl, members);
+	EXPECT_EQ(membersControl, p.getMemberVector(p[0]));
+	EXPECT_EQ(1u, memberIndex.size(p[3]));
+	EXPECT_EQ(0u, memberIndex.size(5));
+
+	std::vector<index> ids = p.getSubsetIdVector();
+	EXPECT_EQ(4u, ids.size());
+	EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+	for (index s : ids) {
+		EXPECT_LT(0u, memberIndex.size(s));
+	}
+}
+
 TEST_F(PartitionGTest, testNumberOfElements) {
 	index n = 10;
 	Partition p(n);
@@ -10,6 +10,7 @@
 #include "UnionFindGTest.h"
 
 #include "../UnionFind.h"
+#include "../ConcurrentUnionFind.h"
 
 #ifndef NOGTEST
 
@@ -72,6 +73,24 @@ TEST_F(UnionFindGTest, testMergeCircular) {
 	}
 }
 
+TEST_F(UnionFindGTest, testConcurrentMergeCircular) {
+	// merge the residue classes modulo 16 in parallel, the representative is the smallest element
+	const index n = 16000;
+	ConcurrentUnionFind p(n);
+
+	#pragma omp parallel for
+	for (index i = 16; i < n; ++i) {
+		p.merge(i, i - 16);
+	}
+
+	Partition part = p.toPartition();
+	for (index i = 0; i < n; ++i) {
+		EXPECT_EQ(i % 16, p.find(i));
+		EXPECT_EQ(i % 16, part[i]);
+	}
+	EXPECT_EQ(16u, part.numberOfSubsets());
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -1 +1 @@
-from _NetworKit import AdamicAdarDistance, Diameter, Eccentricity, EffectiveDiameter, JaccardDistance, AlgebraicDistance
+from _NetworKit import AdamicAdarDistance, Diameter, Eccentricity, EffectiveDiameter, HyperBall, JaccardDistance, AlgebraicDistance